@@ -1,6 +1,8 @@
 
 #include <GASPI.h>
 #include <iostream>
+#include <string>
+#include <vector>
 #include <stdlib.h>
 #include <unistd.h>
 #include <math.h>
@@ -15,20 +17,26 @@
 #include "now.h"
 
 template <typename T>
-void check_min(const int VLEN, const T* res) {
+void check_min(const int VLEN, const T* res, const double threshold) {
     gaspi_rank_t iProc, nProc;
     SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
     SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
     
     bool correct = true;
 
-    for (int i = 0; i < VLEN; i++) {
+    for (int i = 0; i < ceil(threshold * VLEN); i++) {
         T resval = i + 1;
         if (res[i] != resval) {
             //std::cerr << i << ' ' << res[i] << ' ' << resval << '\n';
             correct = false;
         }
     }
+    for (int i = ceil(threshold * VLEN); i < VLEN; i++) {
+        if (res[i] != 0.0) {
+            //std::cerr << i << ' ' << res[i] << ' ' << 0.0 << '\n';
+            correct = false;
+        }
+    }
 
     if (iProc == 0) {
         if (correct) {
@@ -40,20 +48,26 @@ void check_min(const int VLEN, const T* res) {
 }
 
 template <typename T>
-void check_max(const int VLEN, const T* res) {
+void check_max(const int VLEN, const T* res, const double threshold) {
     gaspi_rank_t iProc, nProc;
     SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
     SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
     
     bool correct = true;
 
-    for (int i = 0; i < VLEN; i++) {
+    for (int i = 0; i < ceil(threshold * VLEN); i++) {
         T resval = i + nProc;
         if (res[i] != resval) {
             //std::cerr << i << ' ' << res[i] << ' ' << resval << '\n';
             correct = false;
         }
     }
+    for (int i = ceil(threshold * VLEN); i < VLEN; i++) {
+        if (res[i] != 0.0) {
+            //std::cerr << i << ' ' << res[i] << ' ' << 0.0 << '\n';
+            correct = false;
+        }
+    }
 
     if (iProc == 0) {
         if (correct) {
@@ -65,20 +79,26 @@ void check_max(const int VLEN, const T* res) {
 }
 
 template <typename T>
-void check_sum(const int VLEN, const T* res) {
+void check_sum(const int VLEN, const T* res, const double threshold) {
     gaspi_rank_t iProc, nProc;
     SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
     SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
     
     bool correct = true;
 
-    for (int i = 0; i < VLEN; i++) {
+    for (int i = 0; i < ceil(threshold * VLEN); i++) {
         T resval = (nProc * (nProc + 1)) / 2 + nProc * i;
         if (res[i] != resval) {
             //std::cerr << i << ' ' << res[i] << ' ' << resval << '\n';
             correct = false;
         }
     }
+    for (int i = ceil(threshold * VLEN); i < VLEN; i++) {
+        if (res[i] != 0.0) {
+            //std::cerr << i << ' ' << res[i] << ' ' << 0.0 << '\n';
+            correct = false;
+        }
+    }
 
     if (iProc == 0) {
         if (correct) {
@@ -90,20 +110,20 @@ void check_sum(const int VLEN, const T* res) {
 }
 
 template <typename T>
-void check(const Operation &op, const int VLEN, const T* res) {
+void check(const Operation &op, const int VLEN, const T* res, const double threshold) {
     switch (op) {
         case MIN: {
-            check_min<T>(VLEN, res);
+            check_min<T>(VLEN, res, threshold);
             break;
         }
 
         case MAX: {
-            check_max<T>(VLEN, res);
+            check_max<T>(VLEN, res, threshold);
             break;
         }
 
         case SUM: {
-            check_sum<T>(VLEN, res);
+            check_sum<T>(VLEN, res, threshold);
             break;
         }
 
@@ -113,9 +133,37 @@ void check(const Operation &op, const int VLEN, const T* res) {
     }
 }
 
-// testing the gaspi pipelined ring allreduce
+// calling the allreduce implementation selected by its name
+template <typename T>
+void allreduce(const std::string &algorithm, const segmentBuffer buffer_send, segmentBuffer buffer_recv,
+               const int elem_cnt, const Operation &op, const double threshold, const gaspi_queue_id_t queue_id){
+    if (algorithm == "doubling")
+        gaspi_recursive_doubling_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, GASPI_BLOCK);
+    else if (algorithm == "rabenseifner")
+        gaspi_rabenseifner_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, GASPI_BLOCK);
+    else if (algorithm == "tree")
+        gaspi_tree_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, GASPI_BLOCK);
+    else if (algorithm == "buffered")
+        gaspi_ring_allreduce_buffered<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, GASPI_BLOCK);
+    else if (algorithm == "bidirectional")
+        gaspi_multi_ring_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, 2, queue_id, GASPI_BLOCK);
+    else if (algorithm == "hierarchical")
+        gaspi_hierarchical_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, GASPI_BLOCK);
+    else if (algorithm == "torus")
+        gaspi_torus_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, 0, GRID_RING, GRID_RING, queue_id, GASPI_BLOCK);
+    else if (algorithm == "nonblocking") {
+        collRequest request;
+        gaspi_iallreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, request);
+        gaspi_request_wait(request, GASPI_BLOCK);
+    }
+    else
+        gaspi_ring_allreduce<T>(buffer_send, buffer_recv, elem_cnt, op, threshold, queue_id, GASPI_BLOCK);
+}
+
+// testing the gaspi pipelined ring allreduce, the double-buffered ring, the bidirectional ring, the hierarchical
+// allreduce, the 2D torus, the nonblocking ring, the recursive doubling, the Rabenseifner or the binomial tree allreduce
 template <typename T>
-void test_ring_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+void test_ring_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes, const std::string &algorithm){
   
     gaspi_rank_t iProc, nProc; 
     SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
@@ -165,13 +213,13 @@ void test_ring_allreduce(const Operation &op, const int VLEN, const int numIters
 
         double time = -now();
 
-        gaspi_ring_allreduce<T>(buffer_send, buffer_recv, VLEN, op, queue_id, GASPI_BLOCK);
+        allreduce<T>(algorithm, buffer_send, buffer_recv, VLEN, op, 1.0, queue_id);
 
         time += now();
         t_median[iter] = time;
 
         if (checkRes) {    
-            check<T>(op, VLEN, rcv_arr);
+            check<T>(op, VLEN, rcv_arr, 1.0);
         }
 
         //gaspi_barrier(GASPI_GROUP_ALL, GASPI_BLOCK);
@@ -193,23 +241,1030 @@ void test_ring_allreduce(const Operation &op, const int VLEN, const int numIters
     wait_for_flush_queues();
 }
 
+// testing eventually consistent gaspi allreduce for 25%, 50%, 75% and 100% of the data
+template <typename T>
+void test_evnt_consist_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes, const std::string &algorithm){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
 
-int main(int argc, char** argv) {
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
 
-    if ((argc < 3) || (argc > 4)) {
-        std::cerr << argv[0] << ": Usage " << argv[0] << " <length in elements>"
-                  << " <num iterations> [check]"
-                  << std::endl;
-      return -1;
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("%d \t", VLEN);
     }
 
-    static const int VLEN = atoi(argv[1]);
-    const int numIters = atoi(argv[2]);
-    const bool checkRes = (argc==4)?true:false;
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (int index = 1; index < 5; index++) { 
+        // 25% 50% 75% and 100%
+        gaspi_double threshold = index * 0.25;
+
+        for (int iter=0; iter < numIters; iter++) {
+            fill_array_zeros(VLEN, rcv_arr);
+
+            double time = -now();
+
+            allreduce<T>(algorithm, buffer_send, buffer_recv, VLEN, op, threshold, queue_id);
+
+            time += now();
+            t_median[iter] = time;
+
+            if (checkRes) {    
+                check<T>(op, VLEN, rcv_arr, threshold);
+            }
+        }
+  
+        sort_median(&t_median[0],&t_median[numIters-1]);
+        double mean = calculateMean(numIters, &t_median[0]);
+        double confidenceLevel = calculateConfidenceLevel(numIters, &t_median[0], mean);
+
+        if (iProc == root) {
+            printf("%10.6f \t", t_median[numIters/2]);
+            printf("%10.6f \t", mean);
+            printf("%10.6f \t", confidenceLevel);
+        }
+    }
+
+    if (iProc == root) {
+        printf("\n");
+    }
+
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// comparing the gaspi pipelined ring allreduce with the double-buffered ring, the
+// recursive doubling and the Rabenseifner allreduce for message sizes from one element up to VLEN elements
+template <typename T>
+void test_allreduce_sizes(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    const std::string algorithms[4] = {"ring", "buffered", "doubling", "rabenseifner"};
+
+    if (iProc == root) {
+        printf("bytes \t ring \t double-buffered ring \t recursive doubling \t Rabenseifner\n");
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (int elem_cnt = 1; elem_cnt <= VLEN; elem_cnt *= 2) {
+        if (iProc == root) {
+            printf("%d \t", elem_cnt * type_size);
+        }
+
+        for (int a = 0; a < 4; a++) {
+            for (int iter=0; iter < numIters; iter++) {
+                fill_array_zeros(elem_cnt, rcv_arr);
+
+                double time = -now();
+
+                allreduce<T>(algorithms[a], buffer_send, buffer_recv, elem_cnt, op, 1.0, queue_id);
+
+                time += now();
+                t_median[iter] = time;
+
+                if (checkRes) {    
+                    check<T>(op, elem_cnt, rcv_arr, 1.0);
+                }
+            }
+
+            sort_median(&t_median[0],&t_median[numIters-1]);
+
+            // the slowest process determines the time of the allreduce
+            double t_max;
+            SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                           , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                           , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+            if (iProc == root) {
+                printf("%10.6f \t", t_max);
+            }
+        }
+
+        if (iProc == root) {
+            printf("\n");
+        }
+    }
+
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi pipelined ring allreduce for sub-block sizes from the whole chunk
+// (VLEN/nProc elements) down to a single element
+template <typename T>
+void test_ring_allreduce_subblocks(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("sub-block elements \t median \n");
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (int subblock = MAX((VLEN + nProc - 1) / nProc, 1); ; subblock = MAX(subblock / 4, 1)) {
+        if (iProc == root) {
+            printf("%d \t", subblock);
+        }
+
+        for (int iter=0; iter < numIters; iter++) {
+            fill_array_zeros(VLEN, rcv_arr);
+
+            double time = -now();
+
+            gaspi_ring_allreduce<T>(buffer_send, buffer_recv, VLEN, op, 1.0, subblock, queue_id, GASPI_BLOCK);
+
+            time += now();
+            t_median[iter] = time;
+
+            if (checkRes) {    
+                check<T>(op, VLEN, rcv_arr, 1.0);
+            }
+        }
+
+        sort_median(&t_median[0],&t_median[numIters-1]);
+
+        // the slowest process determines the time of the allreduce
+        double t_max;
+        SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                       , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                       , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+        if (iProc == root) {
+            printf("%10.6f \n", t_max);
+        }
+
+        if (subblock == 1)
+            break;
+    }
+
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi multi-ring allreduce with 1, 2, 4 and 8 rings on separate queues
+template <typename T>
+void test_multi_ring_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("rings \t median \n");
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (int num_rings = 1; num_rings <= 8; num_rings *= 2) {
+        if (iProc == root) {
+            printf("%d \t", num_rings);
+        }
+
+        for (int iter=0; iter < numIters; iter++) {
+            fill_array_zeros(VLEN, rcv_arr);
+
+            double time = -now();
+
+            gaspi_multi_ring_allreduce<T>(buffer_send, buffer_recv, VLEN, op, 1.0, num_rings, queue_id, GASPI_BLOCK);
+
+            time += now();
+            t_median[iter] = time;
+
+            if (checkRes) {    
+                check<T>(op, VLEN, rcv_arr, 1.0);
+            }
+        }
+
+        sort_median(&t_median[0],&t_median[numIters-1]);
+
+        // the slowest process determines the time of the allreduce
+        double t_max;
+        SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                       , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                       , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+        if (iProc == root) {
+            printf("%10.6f \n", t_max);
+        }
+    }
+
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi pipelined ring allreduce with its writes striped across 1, 2, 4 and 8 queues
+template <typename T>
+void test_striped_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("queues \t median \n");
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    gaspi_number_t queue_num;
+    SUCCESS_OR_DIE( gaspi_queue_num(&queue_num) );
+    for (gaspi_number_t num_queues = 1; num_queues <= MIN(queue_num, 8); num_queues *= 2) {
+        if (iProc == root) {
+            printf("%d \t", num_queues);
+        }
+
+        // stripes of at least 64 KB
+        SUCCESS_OR_DIE( gaspi_comm_striping(gaspi_comm_world(), num_queues, 65536) );
+
+        for (int iter=0; iter < numIters; iter++) {
+            fill_array_zeros(VLEN, rcv_arr);
+
+            double time = -now();
+
+            gaspi_ring_allreduce<T>(buffer_send, buffer_recv, VLEN, op, queue_id, GASPI_BLOCK);
+
+            time += now();
+            t_median[iter] = time;
+
+            if (checkRes) {    
+                check<T>(op, VLEN, rcv_arr, 1.0);
+            }
+        }
+
+        sort_median(&t_median[0],&t_median[numIters-1]);
+
+        // the slowest process determines the time of the allreduce
+        double t_max;
+        SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                       , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                       , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+        if (iProc == root) {
+            printf("%10.6f \n", t_max);
+        }
+    }
+
+    SUCCESS_OR_DIE( gaspi_comm_striping(gaspi_comm_world(), 1, 0) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi time-budget allreduce with a budget of 1, 2, 4 and 8 ms and
+// chunks of 1/16 of the data, prints the time and the fraction of the reduced data
+template <typename T>
+void test_budget_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+    gaspi_number_t const chunk_elem_cnt = MAX(VLEN / 16, 1);
+
+    if (iProc == root) {
+        printf("budget \t median \t reduced \n");
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    double *f_median = (double *) calloc(numIters, sizeof(double));
+    for (gaspi_timeout_t budget = 1; budget <= 8; budget *= 2) {
+        if (iProc == root) {
+            printf("%lu \t", (unsigned long) budget);
+        }
+
+        for (int iter=0; iter < numIters; iter++) {
+            fill_array_zeros(VLEN, rcv_arr);
+
+            double time = -now();
+
+            gaspi_number_t completed;
+            gaspi_allreduce_budget<T>(buffer_send, buffer_recv, VLEN, op, chunk_elem_cnt, budget, queue_id, GASPI_BLOCK, completed);
+
+            time += now();
+            t_median[iter] = time;
+            f_median[iter] = (double) completed / VLEN;
+
+            if (checkRes && (completed == (gaspi_number_t) VLEN)) {    
+                check<T>(op, VLEN, rcv_arr, 1.0);
+            }
+        }
+
+        sort_median(&t_median[0],&t_median[numIters-1]);
+        sort_median(&f_median[0],&f_median[numIters-1]);
+
+        // the slowest process determines the time of the allreduce
+        double t_max;
+        SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                       , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                       , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+        if (iProc == root) {
+            printf("%10.6f \t %6.2f \n", t_max, f_median[numIters/2]);
+        }
+    }
+
+    free(t_median);
+    free(f_median);
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi top-k sparse allreduce with k of 1/64, 1/16, 1/4 and all of the
+// data, prints the time of the allgather and of the tree merge
+template <typename T>
+void test_topk_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("k \t allgather \t tree \n");
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (int fraction = 64; fraction >= 1; fraction /= 4) {
+        gaspi_number_t const k = MAX(VLEN / fraction, 1);
+        if (iProc == root) {
+            printf("%u \t", k);
+        }
+
+        for (SparseAlgorithm algorithm : {SPARSE_ALLGATHER, SPARSE_TREE}) {
+            for (int iter=0; iter < numIters; iter++) {
+                fill_array_zeros(VLEN, rcv_arr);
+
+                double time = -now();
+
+                gaspi_topk_allreduce<T>(buffer_send, buffer_recv, VLEN, op, k, algorithm, queue_id, GASPI_BLOCK);
+
+                time += now();
+                t_median[iter] = time;
+
+                // with all elements selected the allgather reduces the whole data
+                if (checkRes && (algorithm == SPARSE_ALLGATHER) && (k == (gaspi_number_t) VLEN)) {    
+                    check<T>(op, VLEN, rcv_arr, 1.0);
+                }
+            }
+
+            sort_median(&t_median[0],&t_median[numIters-1]);
+
+            // the slowest process determines the time of the allreduce
+            double t_max;
+            SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                           , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                           , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+            if (iProc == root) {
+                printf("%10.6f \t", t_max);
+            }
+        }
+
+        if (iProc == root) {
+            printf("\n");
+        }
+    }
+
+    free(t_median);
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi top-k sparse allreduce with error feedback, the data differs between
+// the processes so that the tree drops elements, the sum of all results and the residuals
+// of all processes has to be the sum of the data of all iterations
+template <typename T>
+void test_topk_feedback(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_segment_id_t const segment_residual = 2;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_residual, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+    segmentBuffer buffer_residual = {segment_residual, 0};    
+
+    gaspi_pointer_t send_array, recv_array, residual_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_residual, &residual_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+    T * res_arr = (T *)(residual_array);
+
+    // a different order of the elements on every process
+    for (int i = 0; i < VLEN; i++) {
+        src_arr[i] = (((unsigned long) i) * (2 * iProc + 1)) % VLEN + 1;
+    }
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("algorithm \t time \n");
+    }
+
+    gaspi_number_t const k = MAX(VLEN / 16, 1);
+    std::vector<T> sum(VLEN);
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (SparseAlgorithm algorithm : {SPARSE_ALLGATHER, SPARSE_TREE}) {
+        fill_array_zeros(VLEN, res_arr);
+        std::fill(sum.begin(), sum.end(), 0);
+
+        for (int iter=0; iter < numIters; iter++) {
+            double time = -now();
+
+            gaspi_topk_allreduce_feedback<T>(buffer_send, buffer_recv, buffer_residual, VLEN, k, algorithm, queue_id, GASPI_BLOCK);
+
+            time += now();
+            t_median[iter] = time;
+
+            for (int i = 0; i < VLEN; i++) {
+                sum[i] += rcv_arr[i];
+            }
+        }
+
+        sort_median(&t_median[0],&t_median[numIters-1]);
+
+        // the slowest process determines the time of the allreduce
+        double t_max;
+        SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                       , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                       , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+        if (iProc == root) {
+            printf("%s \t %10.6f \n", (algorithm == SPARSE_TREE) ? "tree" : "allgather", t_max);
+        }
+
+        if (checkRes) {
+            // the residuals of all processes
+            SUCCESS_OR_DIE( gaspi_ring_allreduce<T>(buffer_residual, buffer_recv, VLEN, op, queue_id, GASPI_BLOCK) );
+
+            bool correct = true;
+            for (int i = 0; i < VLEN; i++) {
+                T dense = 0;
+                for (gaspi_rank_t p = 0; p < nProc; p++) {
+                    dense += (((unsigned long) i) * (2 * p + 1)) % VLEN + 1;
+                }
+                if (sum[i] + rcv_arr[i] != numIters * dense) {
+                    //std::cerr << i << ' ' << sum[i] + rcv_arr[i] << ' ' << numIters * dense << '\n';
+                    correct = false;
+                }
+            }
+
+            if (iProc == root) {
+                if (correct) {
+                    std::cout << "Successful run!\n";
+                } else { 
+                    std::cout << "Check FAIL!\n";
+                }
+            }
+        }
+    }
+
+    free(t_median);
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_residual) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi bounded-staleness allreduce with a staleness of 0, 1 and 2 iterations,
+// prints the time per iteration and the average age of the results
+template <typename T>
+void test_stale_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_number_t const max_staleness = 2;
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_segment_id_t const segment_tmp = 2;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_tmp, 2 * (max_staleness + 1) * segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+    segmentBuffer buffer_tmp = {segment_tmp, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    // the data is the same in every iteration, so every result can be checked
+    fill_array(VLEN, src_arr);
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("staleness \t time \t age \n");
+    }
+
+    for (gaspi_number_t staleness = 0; staleness <= max_staleness; staleness++) {
+        collStale stale;
+        SUCCESS_OR_DIE( gaspi_stale_allreduce_init<T>(buffer_send, buffer_tmp, VLEN, op, staleness, queue_id, stale) );
+
+        double age = 0;
+        double time = -now();
+        for (int iter=0; iter < numIters; iter++) {
+            gaspi_number_t version;
+            SUCCESS_OR_DIE( gaspi_stale_allreduce(stale, buffer_recv, version, GASPI_BLOCK) );
+            age += iter - version;
+
+            if (checkRes) {    
+                check<T>(op, VLEN, rcv_arr, 1.0);
+            }
+        }
+        time += now();
+
+        SUCCESS_OR_DIE( gaspi_stale_allreduce_wait(stale, GASPI_BLOCK) );
+
+        // the slowest process determines the time of the allreduce
+        double t_iter = time / numIters;
+        double t_max;
+        SUCCESS_OR_DIE( gaspi_allreduce(&t_iter, &t_max, 1
+                                       , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                       , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+        if (iProc == root) {
+            printf("%u \t %10.6f \t %6.2f \n", staleness, t_max, age / numIters);
+        }
+    }
+
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_tmp) );
+
+    wait_for_flush_queues();
+}
+
+// testing the gaspi pipelined ring allreduce on two communicators at the same time, one of
+// the processes with an even and one of the processes with an odd rank
+template <typename T>
+void test_subgroup_allreduce(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+  
+    gaspi_rank_t iProc, nProc; 
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_send = 0;
+    gaspi_segment_id_t const segment_recv = 1;
+    gaspi_size_t       const segment_size = VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_send, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_recv, segment_size 
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    segmentBuffer buffer_send = {segment_send, 0};    
+    segmentBuffer buffer_recv = {segment_recv, 0};    
+
+    gaspi_pointer_t send_array, recv_array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send, &send_array) );
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv, &recv_array) );
+
+    T * src_arr = (T *)(send_array);
+    T * rcv_arr = (T *)(recv_array);
+
+    fill_array(VLEN, src_arr);
+
+    // every communicator has its own half of the notifications and its own workspace
+    const int color = iProc % 2;
+    std::vector<gaspi_rank_t> ranks;
+    for (gaspi_rank_t p = color; p < nProc; p += 2)
+        ranks.push_back(p);
+
+    gaspi_number_t notification_num, segment_max;
+    SUCCESS_OR_DIE( gaspi_notification_num(&notification_num) );
+    SUCCESS_OR_DIE( gaspi_segment_max(&segment_max) );
+
+    collComm comm;
+    SUCCESS_OR_DIE( gaspi_comm_create(ranks.data(), ranks.size()
+                                     , color * (notification_num / 2), notification_num / 2
+                                     , segment_max - 2 - color, GASPI_BLOCK, comm) );
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("%d \t", VLEN);
+    }
+
+    double *t_median = (double *) calloc(numIters, sizeof(double));
+    for (int iter=0; iter < numIters; iter++) {
+        fill_array_zeros(VLEN, rcv_arr);
+
+        double time = -now();
+
+        gaspi_ring_allreduce<T>(buffer_send, buffer_recv, VLEN, op, queue_id, GASPI_BLOCK, comm);
+
+        time += now();
+        t_median[iter] = time;
+
+        if (checkRes && (op == SUM)) {
+            // the sum of i + p + 1 over the ranks p of the communicator
+            bool correct = true;
+            T sum_ranks = 0;
+            for (auto p : ranks)
+                sum_ranks += p + 1;
+            for (int i = 0; i < VLEN; i++) {
+                if (rcv_arr[i] != sum_ranks + (T) ranks.size() * i)
+                    correct = false;
+            }
+            if (iProc < 2) {
+                if (correct) {
+                    std::cout << "Successful run!\n";
+                } else { 
+                    std::cout << "Check FAIL!\n";
+                }
+            }
+        }
+    }
+  
+    sort_median(&t_median[0],&t_median[numIters-1]);
+    double mean = calculateMean(numIters, &t_median[0]);
+    double confidenceLevel = calculateConfidenceLevel(numIters, &t_median[0], mean);
+
+    if (iProc == root) {
+        printf("%10.6f \t", t_median[numIters/2]);
+        printf("%10.6f \t", mean);
+        printf("%10.6f \n", confidenceLevel);
+    }
+
+    SUCCESS_OR_DIE( gaspi_comm_delete(comm) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_send) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv) );
+
+    wait_for_flush_queues();
+}
+
+
+int main(int argc, char** argv) {
+
+    if ((argc < 3) || (argc > 6)) {
+        std::cerr << argv[0] << ": Usage " << argv[0] << " <length in elements>"
+                  << " <num iterations> [check] [ring|buffered|bidirectional|hierarchical|torus|nonblocking|doubling|rabenseifner|tree] [threshold|sizes|subblocks|rings|stripes|groups|budget|topk|feedback|stale]"
+                  << std::endl;
+      return -1;
+    }
+
+    static const int VLEN = atoi(argv[1]);
+    const int numIters = atoi(argv[2]);
+    bool checkRes = false;
+    std::string algorithm = "ring";
+    std::string mode = "";
+    for (int i = 3; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == "check")
+            checkRes = true;
+        else if ((arg == "ring") || (arg == "buffered") || (arg == "bidirectional") || (arg == "hierarchical")
+                 || (arg == "torus") || (arg == "nonblocking") || (arg == "doubling") || (arg == "rabenseifner") || (arg == "tree"))
+            algorithm = arg;
+        else
+            mode = arg;
+    }
 
     SUCCESS_OR_DIE( gaspi_proc_init(GASPI_BLOCK) );
 
-    test_ring_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    if (mode == "sizes")
+        test_allreduce_sizes<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "rings")
+        test_multi_ring_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "stripes")
+        test_striped_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "groups")
+        test_subgroup_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "budget")
+        test_budget_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "topk")
+        test_topk_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "feedback")
+        test_topk_feedback<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "stale")
+        test_stale_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "subblocks")
+        test_ring_allreduce_subblocks<double>(Operation::SUM, VLEN, numIters, checkRes); 
+    else if (mode == "threshold")
+        test_evnt_consist_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes, algorithm); 
+    else
+        test_ring_allreduce<double>(Operation::SUM, VLEN, numIters, checkRes, algorithm); 
 
     SUCCESS_OR_DIE( gaspi_proc_term(GASPI_BLOCK) );
 
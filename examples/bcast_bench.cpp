@@ -1,6 +1,7 @@
 
 #include <GASPI.h>
 #include <iostream>
+#include <string>
 #include <math.h>
 
 #include "EvntConsistColl.hxx"
@@ -12,7 +13,7 @@
 #include "now.h"
 
 template <typename T>
-void check(const int VLEN, const T* res, const int proc) {
+void check(const int VLEN, const T* res, const int root, const int proc) {
     gaspi_rank_t iProc, nProc;
     SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
     SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
@@ -20,7 +21,7 @@ void check(const int VLEN, const T* res, const int proc) {
     bool correct = true;
 
     for (int i = 0; i < VLEN; i++) {
-        T resval = i + 1;
+        T resval = i + root + 1;
         if (res[i] != resval) {
             std::cerr << i << ' ' << res[i] << ' ' << resval << '\n';
             correct = false;
@@ -109,7 +110,7 @@ void test_bcast(const int VLEN, const int numIters, const bool checkRes){
     t_median[itime] = time;
 
     if (iProc == (nProc - 1) && checkRes) {    
-      check<T>(VLEN, arr, nProc - 1);
+      check<T>(VLEN, arr, root, nProc - 1);
     }
 
     //gaspi_barrier(GASPI_GROUP_ALL, GASPI_BLOCK);
@@ -125,8 +126,9 @@ void test_bcast(const int VLEN, const int numIters, const bool checkRes){
 }
 
 // testing eventually consistent gaspi bcast that is based on binomial tree
+// or on scatter and ring allgather
 template <typename T>
-void test_evnt_consist_bcast(const int VLEN, const int numIters, const bool checkRes){
+void test_evnt_consist_bcast(const int VLEN, const int numIters, const bool checkRes, const bool scatter){
 
   gaspi_rank_t iProc, nProc;
   SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
@@ -172,7 +174,10 @@ void test_evnt_consist_bcast(const int VLEN, const int numIters, const bool chec
 
         double time = -now();
 
-        gaspi_bcast<T>(buffer, VLEN, threshold, root, queue_id, GASPI_BLOCK);
+        if (scatter)
+          gaspi_bcast_scatter_allgather<T>(buffer, VLEN, threshold, root, queue_id, GASPI_BLOCK);
+        else
+          gaspi_bcast<T>(buffer, VLEN, threshold, root, queue_id, GASPI_BLOCK);
         //gaspi_bcast_simple<T>(buffer, VLEN, threshold, root, queue_id, GASPI_BLOCK);
   
         time += now();
@@ -203,12 +208,236 @@ void test_evnt_consist_bcast(const int VLEN, const int numIters, const bool chec
   wait_for_flush_queues();
 }
 
+// testing pipelined gaspi bcast that is based on binomial tree for different chunk lengths
+template <typename T>
+void test_bcast_pipelined(const int VLEN, const int numIters, const bool checkRes){
+
+  gaspi_rank_t iProc, nProc;
+  SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+  SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
+
+  const int type_size = sizeof(T);
+  
+  gaspi_rank_t root = 0;
+  gaspi_queue_id_t queue_id = 0;
+
+  gaspi_segment_id_t const segment_id = 1;
+  gaspi_size_t       const segment_size = VLEN * type_size;
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  segmentBuffer buffer = {segment_id, 0};    
+    
+  gaspi_pointer_t array;
+  SUCCESS_OR_DIE( gaspi_segment_ptr (buffer.segment, &array) );
+ 
+  T *arr = (T *)(array);
+
+  if (iProc == 0) {
+    printf("%d \t", VLEN);
+  }
+
+  double *t_median = (double *) calloc(numIters, sizeof(double));
+  for (int index = 3; index >= 0; index--) { 
+      // VLEN/64, VLEN/16, VLEN/4 and VLEN elements per chunk
+      gaspi_number_t chunk_elem_cnt = MAX(VLEN >> (2 * index), 1);
+
+      // measure execution time
+      for (int itime = 0; itime < numIters; itime++) { 
+        if (iProc == root) 
+          fill_array(VLEN, arr);
+        else 
+          fill_array_zeros(VLEN, arr);
+
+        double time = -now();
+
+        gaspi_bcast_pipelined<T>(buffer, VLEN, chunk_elem_cnt, root, queue_id, GASPI_BLOCK);
+  
+        time += now();
+        t_median[itime] = time;
+
+        if (iProc == (nProc - 1) && checkRes) {    
+          check<T>(VLEN, arr, root, nProc - 1);
+        }
+      }
+      
+      sort_median(&t_median[0],&t_median[numIters-1]);
+      double mean = calculateMean(numIters, &t_median[0]);
+      double confidenceLevel = calculateConfidenceLevel(numIters, &t_median[0], mean);
+
+      if (iProc == 0) {
+        printf("%10.6f \t", t_median[numIters/2]);
+        printf("%10.6f \t", mean);
+        printf("%10.6f \t", confidenceLevel);
+      }
+  }
+
+  if (iProc == 0) {
+    printf("\n");
+  }
+
+  wait_for_flush_queues();
+}
+
+// testing gaspi bcast that is based on binomial tree for every process as the root
+template <typename T>
+void test_bcast_roots(const int VLEN, const int numIters, const bool checkRes){
+
+  gaspi_rank_t iProc, nProc;
+  SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+  SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
+
+  const int type_size = sizeof(T);
+  
+  gaspi_queue_id_t queue_id = 0;
+
+  gaspi_segment_id_t const segment_id = 0;
+  gaspi_size_t       const segment_size = VLEN * type_size;
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  segmentBuffer buffer = {segment_id, 0};    
+  
+  gaspi_pointer_t array;
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_id, &array) );
+  T *arr = (T *)(array);
+
+  if (iProc == 0) {
+    printf("%d \t", VLEN);
+  }
+
+  double *t_median = (double *) calloc(numIters, sizeof(double));
+  for (gaspi_rank_t root = 0; root < nProc; root++) { 
+    // measure execution time
+    for (int itime = 0; itime < numIters; itime++) { 
+      if (iProc == root) 
+        fill_array(VLEN, arr);
+      else 
+        fill_array_zeros(VLEN, arr);
+
+      double time = -now();
+
+      gaspi_bcast<T>(buffer, VLEN, root, queue_id, GASPI_BLOCK);
+
+      time += now();
+      t_median[itime] = time;
+
+      if (iProc == (root + nProc - 1) % nProc && checkRes) {    
+        check<T>(VLEN, arr, root, iProc);
+      }
+    }
+    
+    sort_median(&t_median[0],&t_median[numIters-1]);
+
+    // the slowest process determines the time of the broadcast
+    double t_max;
+    SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                   , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                   , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+    if (iProc == 0) {
+      printf("%10.6f \t", t_max);
+    }
+  }
+
+  if (iProc == 0) {
+    printf("\n");
+  }
+  
+  wait_for_flush_queues();
+}
+
+// testing gaspi bcast that is based on k-nomial tree for different radices
+template <typename T>
+void test_bcast_knomial(const int VLEN, const int numIters, const bool checkRes){
+
+  gaspi_rank_t iProc, nProc;
+  SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+  SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
+
+  const int type_size = sizeof(T);
+  
+  gaspi_rank_t root = 0;
+  gaspi_queue_id_t queue_id = 0;
+
+  gaspi_segment_id_t const segment_id = 1;
+  gaspi_size_t       const segment_size = VLEN * type_size;
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  segmentBuffer buffer = {segment_id, 0};    
+    
+  gaspi_pointer_t array;
+  SUCCESS_OR_DIE( gaspi_segment_ptr (buffer.segment, &array) );
+ 
+  T *arr = (T *)(array);
+
+  if (iProc == 0) {
+    printf("%d \t", VLEN);
+  }
+
+  double *t_median = (double *) calloc(numIters, sizeof(double));
+  for (gaspi_number_t radix = 2; radix <= 16; radix *= 2) { 
+      // measure execution time
+      for (int itime = 0; itime < numIters; itime++) { 
+        if (iProc == root) 
+          fill_array(VLEN, arr);
+        else 
+          fill_array_zeros(VLEN, arr);
+
+        double time = -now();
+
+        gaspi_bcast_knomial<T>(buffer, VLEN, radix, root, queue_id, GASPI_BLOCK);
+  
+        time += now();
+        t_median[itime] = time;
+
+        if (iProc == (nProc - 1) && checkRes) {    
+          check<T>(VLEN, arr, root, nProc - 1);
+        }
+      }
+      
+      sort_median(&t_median[0],&t_median[numIters-1]);
+
+      // the slowest process determines the time of the broadcast
+      double t_max;
+      SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                     , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                     , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+      if (iProc == 0) {
+        printf("%10.6f \t", t_max);
+      }
+  }
+
+  if (iProc == 0) {
+    printf("\n");
+  }
+
+  wait_for_flush_queues();
+}
+
 
 int main(int argc, char** argv) {
 
-  if ((argc < 3) || (argc > 4)) {
+  if ((argc < 3) || (argc > 5)) {
     std::cerr << argv[0] << ": Usage " << argv[0] << " <length in elements>"
-              << " <num iterations> [check]"
+              << " <num iterations> [check] [threshold|scatter|pipelined|knomial|roots]"
               << std::endl;
     return -1;
   }
@@ -217,11 +446,25 @@ int main(int argc, char** argv) {
 
   static const int VLEN = atoi(argv[1]);
   const int numIters = atoi(argv[2]);
-  const bool checkRes = (argc==4)?true:false;
+  bool checkRes = false;
+  std::string mode = "threshold";
+  for (int i = 3; i < argc; i++) {
+    if (std::string(argv[i]) == "check")
+      checkRes = true;
+    else
+      mode = argv[i];
+  }
 
   //test_bcast<double>(VLEN, numIters, checkRes); 
 
-  test_evnt_consist_bcast<double>(VLEN, numIters, checkRes); 
+  if (mode == "roots")
+    test_bcast_roots<double>(VLEN, numIters, checkRes); 
+  else if (mode == "knomial")
+    test_bcast_knomial<double>(VLEN, numIters, checkRes); 
+  else if (mode == "pipelined")
+    test_bcast_pipelined<double>(VLEN, numIters, checkRes); 
+  else
+    test_evnt_consist_bcast<double>(VLEN, numIters, checkRes, mode == "scatter"); 
  
   SUCCESS_OR_DIE( gaspi_proc_term(GASPI_BLOCK) );
 
@@ -0,0 +1,270 @@
+
+#include <GASPI.h>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <math.h>
+
+#include "EvntConsistColl.hxx"
+#include "Allreduce.hxx"
+
+#include "success_or_die.h"
+#include "queue.h"
+
+// the regions of VLEN elements of the only data segment, i.e. all collectives
+// take their notification windows from the same range
+enum stressRegion { PLAN_BCAST
+                  , PLAN_SEND
+                  , PLAN_RECV
+                  , BLOCK_BCAST
+                  , BLOCK_SEND
+                  , BLOCK_RECV
+                  , NONBLOCK_BCAST
+                  , RING_SEND
+                  , RING_RECV
+                  , NONBLOCK_SEND
+                  , NONBLOCK_RECV
+                  , KNOMIAL_BCAST
+                  , KNOMIAL_SEND
+                  , KNOMIAL_RECV
+                  , KNOMIAL_TMP // radix - 1 regions
+                  , PIPELINED_BCAST = KNOMIAL_TMP + 2
+                  , NUM_REGIONS };
+
+// value of element i which the process rank contributes in iteration iter
+template <typename T>
+T stress_value(const int i, const gaspi_rank_t rank, const int iter) {
+    return i + rank + 1 + iter;
+}
+
+// checks the broadcast from root in the region
+template <typename T>
+bool check_bcast(const int VLEN, const T* res, const gaspi_rank_t root, const int iter) {
+    bool correct = true;
+    for (int i = 0; i < VLEN; i++) {
+        if (res[i] != stress_value<T>(i, root, iter)) {
+            //std::cerr << i << ' ' << res[i] << ' ' << stress_value<T>(i, root, iter) << '\n';
+            correct = false;
+        }
+    }
+    return correct;
+}
+
+// checks the sum of the contributions of all processes at the root
+template <typename T>
+bool check_reduce(const int VLEN, const T* res, const gaspi_rank_t nProc, const int iter) {
+    bool correct = true;
+    for (int i = 0; i < VLEN; i++) {
+        T resval = 0;
+        for (gaspi_rank_t p = 0; p < nProc; p++)
+            resval += stress_value<T>(i, p, iter);
+        if (res[i] != resval) {
+            //std::cerr << i << ' ' << res[i] << ' ' << resval << '\n';
+            correct = false;
+        }
+    }
+    return correct;
+}
+
+// fills the region for a broadcast, the data of the processes other than the root is cleared
+template <typename T>
+void fill_bcast(const int VLEN, T* arr, const gaspi_rank_t iProc, const gaspi_rank_t root, const int iter) {
+    for (int i = 0; i < VLEN; i++)
+        arr[i] = (iProc == root) ? stress_value<T>(i, root, iter) : 0;
+}
+
+// fills the region with the contribution of the process to a reduce or an allreduce
+template <typename T>
+void fill_reduce(const int VLEN, T* arr, const gaspi_rank_t iProc, const int iter) {
+    for (int i = 0; i < VLEN; i++)
+        arr[i] = stress_value<T>(i, iProc, iter);
+}
+
+// runs persistent, nonblocking and blocking binomial tree, ring, k-nomial and pipelined
+// collectives on one segment of a communicator with a notification range of only a few
+// windows. The persistent plans are in progress while the blocking and nonblocking
+// collectives run back to back, and the reduce plan is planned again with another root
+// every fourth iteration, so the windows wrap around the range and have to skip the
+// reserved windows of the plans and of the nonblocking allreduce
+template <typename T>
+void test_notification_stress(const int VLEN, const int numIters) {
+
+    gaspi_rank_t iProc, nProc;
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    int root = 0;
+
+    const int type_size = sizeof(T);
+    gaspi_segment_id_t const segment_id = 0;
+    gaspi_size_t       const segment_size = NUM_REGIONS * VLEN * type_size;
+
+    SUCCESS_OR_DIE
+      ( gaspi_segment_create
+        ( segment_id, segment_size
+        , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+        )
+      );
+
+    gaspi_pointer_t array;
+    SUCCESS_OR_DIE( gaspi_segment_ptr (segment_id, &array) );
+    auto region = [&](stressRegion r) { return (T *)(array) + r * VLEN; };
+
+    // the broadcasts take the offset in elements, the reduces in bytes
+    auto bcast_buffer = [&](stressRegion r) { return segmentBuffer {segment_id, (gaspi_offset_t) (r * VLEN)}; };
+    auto reduce_buffer = [&](stressRegion r) { return segmentBuffer {segment_id, (gaspi_offset_t) (r * VLEN * type_size)}; };
+
+    // the reserved windows of the four requests and the window of every blocking
+    // collective, up to 2 * nProc ids and a chunk for the pipelined broadcast, fit
+    // into the range even if the free ids are split between the reserved windows
+    int upper_bound = ceil(log2(nProc));
+    gaspi_number_t const notification_range = 16 * (upper_bound + 1) + 16 * nProc;
+    gaspi_number_t const radix = 3;
+
+    std::vector<gaspi_rank_t> ranks(nProc);
+    for (gaspi_rank_t p = 0; p < nProc; p++)
+        ranks[p] = p;
+
+    gaspi_number_t segment_max;
+    SUCCESS_OR_DIE( gaspi_segment_max(&segment_max) );
+
+    collComm comm;
+    SUCCESS_OR_DIE( gaspi_comm_create(ranks.data(), ranks.size()
+                                     , 0, notification_range
+                                     , segment_max - 2, GASPI_BLOCK, comm) );
+
+    gaspi_queue_id_t queue_id = 0;
+
+    if (iProc == root) {
+        printf("processes \t notifications \t iterations \n");
+        printf("%u \t %u \t %d \n", nProc, notification_range, numIters);
+    }
+
+    collRequest plan_bcast, plan_reduce;
+    SUCCESS_OR_DIE( gaspi_bcast_init<T>(bcast_buffer(PLAN_BCAST), VLEN, root, queue_id, plan_bcast, comm) );
+
+    bool correct = true;
+    gaspi_rank_t plan_root = 0;
+    for (int iter = 0; iter < numIters; iter++) {
+        // plan the reduce again with another root, which releases its windows
+        if (iter % 4 == 0) {
+            plan_root = (iter / 4) % nProc;
+            SUCCESS_OR_DIE( gaspi_reduce_init<T>(reduce_buffer(PLAN_SEND), reduce_buffer(PLAN_RECV), VLEN, SUM
+                                                , plan_root, queue_id, plan_reduce, comm) );
+        }
+
+        fill_bcast(VLEN, region(PLAN_BCAST), iProc, root, iter);
+        fill_reduce(VLEN, region(PLAN_SEND), iProc, iter);
+
+        SUCCESS_OR_DIE( gaspi_request_start(plan_bcast) );
+        SUCCESS_OR_DIE( gaspi_request_start(plan_reduce) );
+
+        // blocking broadcasts from two roots back to back, while the plans are in progress
+        for (int b = 0; b < 2; b++) {
+            gaspi_rank_t const bcast_root = (iter + b) % nProc;
+            fill_bcast(VLEN, region(BLOCK_BCAST), iProc, bcast_root, iter);
+            SUCCESS_OR_DIE( gaspi_bcast<T>(bcast_buffer(BLOCK_BCAST), VLEN, bcast_root, queue_id, GASPI_BLOCK, comm) );
+            correct = correct && check_bcast(VLEN, region(BLOCK_BCAST), bcast_root, iter);
+        }
+
+        // ring allreduce directly after the broadcasts
+        fill_reduce(VLEN, region(RING_SEND), iProc, iter);
+        SUCCESS_OR_DIE( gaspi_ring_allreduce<T>(reduce_buffer(RING_SEND), reduce_buffer(RING_RECV), VLEN, SUM
+                                               , queue_id, GASPI_BLOCK, comm) );
+        correct = correct && check_reduce(VLEN, region(RING_RECV), nProc, iter);
+
+        // nonblocking allreduce, which keeps its window reserved while the
+        // k-nomial and pipelined collectives run
+        collRequest iallreduce;
+        fill_reduce(VLEN, region(NONBLOCK_SEND), iProc, iter);
+        SUCCESS_OR_DIE( gaspi_iallreduce<T>(reduce_buffer(NONBLOCK_SEND), reduce_buffer(NONBLOCK_RECV), VLEN, SUM
+                                           , queue_id, iallreduce, comm) );
+
+        gaspi_rank_t const knomial_root = (iter + 2) % nProc;
+        fill_bcast(VLEN, region(KNOMIAL_BCAST), iProc, knomial_root, iter);
+        SUCCESS_OR_DIE( gaspi_bcast_knomial<T>(bcast_buffer(KNOMIAL_BCAST), VLEN, radix, knomial_root
+                                              , queue_id, GASPI_BLOCK, comm) );
+        correct = correct && check_bcast(VLEN, region(KNOMIAL_BCAST), knomial_root, iter);
+
+        fill_reduce(VLEN, region(KNOMIAL_SEND), iProc, iter);
+        SUCCESS_OR_DIE( gaspi_reduce_knomial<T>(reduce_buffer(KNOMIAL_SEND), reduce_buffer(KNOMIAL_RECV)
+                                               , reduce_buffer(KNOMIAL_TMP), VLEN, SUM, radix, knomial_root
+                                               , queue_id, GASPI_BLOCK, comm) );
+        if (iProc == knomial_root)
+            correct = correct && check_reduce(VLEN, region(KNOMIAL_RECV), nProc, iter);
+
+        // the pipelined broadcast sends chunks of a quarter of the data
+        gaspi_rank_t const pipelined_root = (iter + 3) % nProc;
+        fill_bcast(VLEN, region(PIPELINED_BCAST), iProc, pipelined_root, iter);
+        SUCCESS_OR_DIE( gaspi_bcast_pipelined<T>(bcast_buffer(PIPELINED_BCAST), VLEN, (VLEN + 3) / 4, pipelined_root
+                                                , queue_id, GASPI_BLOCK, comm) );
+        correct = correct && check_bcast(VLEN, region(PIPELINED_BCAST), pipelined_root, iter);
+
+        SUCCESS_OR_DIE( gaspi_request_wait(iallreduce, GASPI_BLOCK) );
+        correct = correct && check_reduce(VLEN, region(NONBLOCK_RECV), nProc, iter);
+
+        // blocking reduce directly after the nonblocking allreduce
+        gaspi_rank_t const reduce_root = iter % nProc;
+        fill_reduce(VLEN, region(BLOCK_SEND), iProc, iter);
+        SUCCESS_OR_DIE( gaspi_reduce<T>(reduce_buffer(BLOCK_SEND), reduce_buffer(BLOCK_RECV), VLEN, SUM
+                                       , reduce_root, queue_id, GASPI_BLOCK, comm) );
+        // a reduce on a single process leaves the receive buffer alone
+        if ((nProc > 1) && (iProc == reduce_root))
+            correct = correct && check_reduce(VLEN, region(BLOCK_RECV), nProc, iter);
+
+        // nonblocking broadcast, its request releases its windows at the end of the scope
+        {
+            collRequest request;
+            gaspi_rank_t const ibcast_root = (iter + 1) % nProc;
+            fill_bcast(VLEN, region(NONBLOCK_BCAST), iProc, ibcast_root, iter);
+            SUCCESS_OR_DIE( gaspi_ibcast<T>(bcast_buffer(NONBLOCK_BCAST), VLEN, ibcast_root, queue_id, request, comm) );
+            SUCCESS_OR_DIE( gaspi_request_wait(request, GASPI_BLOCK) );
+            correct = correct && check_bcast(VLEN, region(NONBLOCK_BCAST), ibcast_root, iter);
+        }
+
+        SUCCESS_OR_DIE( gaspi_request_wait(plan_bcast, GASPI_BLOCK) );
+        SUCCESS_OR_DIE( gaspi_request_wait(plan_reduce, GASPI_BLOCK) );
+        correct = correct && check_bcast(VLEN, region(PLAN_BCAST), root, iter);
+        if ((nProc > 1) && (iProc == plan_root))
+            correct = correct && check_reduce(VLEN, region(PLAN_RECV), nProc, iter);
+    }
+
+    // all processes have to pass their checks
+    int passed = correct ? 1 : 0, all_passed;
+    SUCCESS_OR_DIE( gaspi_allreduce(&passed, &all_passed, 1
+                                   , GASPI_OP_MIN, GASPI_TYPE_INT
+                                   , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+    if (iProc == root) {
+        if (all_passed) {
+            std::cout << "Successful run!\n";
+        } else {
+            std::cout << "Check FAIL!\n";
+        }
+    }
+
+    wait_for_flush_queues();
+
+    SUCCESS_OR_DIE( gaspi_comm_delete(comm) );
+    SUCCESS_OR_DIE( gaspi_segment_delete(segment_id) );
+}
+
+int main(int argc, char** argv) {
+
+    if (argc != 3) {
+        std::cerr << argv[0] << ": Usage " << argv[0] << " <length in elements>"
+                  << " <num iterations>"
+                  << std::endl;
+      return -1;
+    }
+
+    static const int VLEN = atoi(argv[1]);
+    const int numIters = atoi(argv[2]);
+
+    SUCCESS_OR_DIE( gaspi_proc_init(GASPI_BLOCK) );
+
+    test_notification_stress<double>(VLEN, numIters);
+
+    SUCCESS_OR_DIE( gaspi_proc_term(GASPI_BLOCK) );
+
+    return EXIT_SUCCESS;
+}
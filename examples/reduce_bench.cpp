@@ -1,6 +1,7 @@
 
 #include <GASPI.h>
 #include <iostream>
+#include <string>
 #include <math.h>
 
 #include "EvntConsistColl.hxx"
@@ -297,12 +298,315 @@ void test_evnt_consist_reduce(const Operation &op, const int VLEN, const int num
   wait_for_flush_queues();
 }
 
+// testing gaspi reduce that is based on binomial tree for every process as the root
+template <typename T>
+void test_reduce_roots(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+
+  gaspi_rank_t iProc, nProc;
+  SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+  SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
+
+  const int type_size = sizeof(T);
+  
+  gaspi_queue_id_t queue_id = 0;
+
+  gaspi_segment_id_t const segment_send_id = 0;
+  gaspi_segment_id_t const segment_recv_id = 1;
+  gaspi_size_t       const segment_size = VLEN * type_size;
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_send_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_recv_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  segmentBuffer buffer_send = {segment_send_id, 0};    
+  segmentBuffer buffer_recv = {segment_recv_id, 0};    
+  
+  gaspi_pointer_t send_array, recv_array;
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send_id, &send_array) );
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv_id, &recv_array) );
+ 
+  T * src_arr = (T *)(send_array);
+  T * rcv_arr = (T *)(recv_array);
+
+  fill_array(VLEN, src_arr);
+
+  if (iProc == 0) {
+    printf("%d \t", VLEN);
+  }
+
+  double *t_median = (double *) calloc(numIters, sizeof(double));
+  for (gaspi_rank_t root = 0; root < nProc; root++) { 
+    // measure execution time
+    for (int itime = 0; itime < numIters; itime++) { 
+      fill_array_zeros(VLEN, rcv_arr);
+
+      double time = -now();
+
+      gaspi_reduce<T>(buffer_send, buffer_recv, VLEN, op, root, queue_id, GASPI_BLOCK);
+
+      time += now();
+      t_median[itime] = time;
+
+      if (iProc == root && checkRes) {    
+        check(op, VLEN, rcv_arr, 1.0);
+      }
+    }
+    
+    sort_median(&t_median[0],&t_median[numIters-1]);
+
+    // the slowest process determines the time of the reduction
+    double t_max;
+    SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                   , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                   , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+    if (iProc == 0) {
+      printf("%10.6f \t", t_max);
+    }
+  }
+
+  if (iProc == 0) {
+    printf("\n");
+  }
+
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_send_id) );
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv_id) );
+  
+  wait_for_flush_queues();
+}
+
+// testing gaspi reduce that is based on k-nomial tree for different radices
+template <typename T>
+void test_reduce_knomial(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+
+  gaspi_rank_t iProc, nProc;
+  SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+  SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
+
+  const int type_size = sizeof(T);
+  const gaspi_number_t max_radix = 16;
+  
+  gaspi_rank_t root = 0;
+  gaspi_queue_id_t queue_id = 0;
+
+  gaspi_segment_id_t const segment_send_id = 0;
+  gaspi_segment_id_t const segment_recv_id = 1;
+  gaspi_segment_id_t const segment_tmp_id = 2;
+  gaspi_size_t       const segment_size = VLEN * type_size;
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_send_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_recv_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  // one slot per child of a round
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_tmp_id, (max_radix - 1) * segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  segmentBuffer buffer_send = {segment_send_id, 0};    
+  segmentBuffer buffer_recv = {segment_recv_id, 0};    
+  segmentBuffer buffer_tmp = {segment_tmp_id, 0};    
+  
+  gaspi_pointer_t send_array, recv_array;
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send_id, &send_array) );
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv_id, &recv_array) );
+ 
+  T * src_arr = (T *)(send_array);
+  T * rcv_arr = (T *)(recv_array);
+
+  fill_array(VLEN, src_arr);
+
+  if (iProc == 0) {
+    printf("%d \t", VLEN);
+  }
+
+  double *t_median = (double *) calloc(numIters, sizeof(double));
+  for (gaspi_number_t radix = 2; radix <= max_radix; radix *= 2) { 
+    // measure execution time
+    for (int itime = 0; itime < numIters; itime++) { 
+      fill_array_zeros(VLEN, rcv_arr);
+
+      double time = -now();
+
+      gaspi_reduce_knomial<T>(buffer_send, buffer_recv, buffer_tmp, VLEN, op, radix, root, queue_id, GASPI_BLOCK);
+
+      time += now();
+      t_median[itime] = time;
+
+      if (iProc == root && checkRes) {    
+        check(op, VLEN, rcv_arr, 1.0);
+      }
+    }
+    
+    sort_median(&t_median[0],&t_median[numIters-1]);
+
+    // the slowest process determines the time of the reduction
+    double t_max;
+    SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                   , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                   , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+    if (iProc == 0) {
+      printf("%10.6f \t", t_max);
+    }
+  }
+
+  if (iProc == 0) {
+    printf("\n");
+  }
+
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_send_id) );
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv_id) );
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_tmp_id) );
+  
+  wait_for_flush_queues();
+}
+
+
+// testing gaspi quorum reduce for the quorums 25%, 50%, 75% and 100% without
+// waiting for late processes, prints the time and the number of processes
+// whose data has been reduced
+template <typename T>
+void test_reduce_quorum(const Operation &op, const int VLEN, const int numIters, const bool checkRes){
+
+  gaspi_rank_t iProc, nProc;
+  SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+  SUCCESS_OR_DIE( gaspi_proc_num (&nProc) );
+
+  const int type_size = sizeof(T);
+  
+  gaspi_rank_t root = 0;
+  gaspi_queue_id_t queue_id = 0;
+
+  gaspi_segment_id_t const segment_send_id = 0;
+  gaspi_segment_id_t const segment_recv_id = 1;
+  gaspi_segment_id_t const segment_tmp_id = 2;
+  gaspi_size_t       const segment_size = VLEN * type_size;
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_send_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_recv_id, segment_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  // one slot per level of the tree and one for the partial result
+  gaspi_size_t const slot_size = ((segment_size + 7) / 8) * 8 + ((nProc * sizeof(int) + 7) / 8) * 8;
+  SUCCESS_OR_DIE
+    ( gaspi_segment_create
+      ( segment_tmp_id, (ceil(log2(nProc)) + 1) * slot_size
+      , GASPI_GROUP_ALL, GASPI_BLOCK, GASPI_MEM_INITIALIZED
+      )
+    );
+
+  segmentBuffer buffer_send = {segment_send_id, 0};    
+  segmentBuffer buffer_recv = {segment_recv_id, 0};    
+  segmentBuffer buffer_tmp = {segment_tmp_id, 0};    
+  
+  gaspi_pointer_t send_array, recv_array;
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_send_id, &send_array) );
+  SUCCESS_OR_DIE( gaspi_segment_ptr (segment_recv_id, &recv_array) );
+ 
+  T * src_arr = (T *)(send_array);
+  T * rcv_arr = (T *)(recv_array);
+
+  fill_array(VLEN, src_arr);
+
+  if (iProc == 0) {
+    printf("%d \t", VLEN);
+  }
+
+  std::vector<gaspi_rank_t> included;
+  double *t_median = (double *) calloc(numIters, sizeof(double));
+  for (int index = 1; index < 5; index++) { 
+    // 25% 50% 75% and 100%
+    gaspi_double quorum = index * 0.25;
+    gaspi_number_t num_included = 0;
+
+    // measure execution time
+    for (int itime = 0; itime < numIters; itime++) { 
+      fill_array_zeros(VLEN, rcv_arr);
+
+      double time = -now();
+
+      gaspi_reduce_quorum<T>(buffer_send, buffer_recv, buffer_tmp, VLEN, op, quorum, 0, root, queue_id, GASPI_BLOCK, included);
+
+      time += now();
+      t_median[itime] = time;
+
+      if (iProc == root) {
+        num_included += included.size();
+
+        if (checkRes && (included.size() == nProc)) {
+          check(op, VLEN, rcv_arr, 1.0);
+        }
+      }
+    }
+    
+    sort_median(&t_median[0],&t_median[numIters-1]);
+
+    // the slowest process determines the time of the reduction
+    double t_max;
+    SUCCESS_OR_DIE( gaspi_allreduce(&t_median[numIters/2], &t_max, 1
+                                   , GASPI_OP_MAX, GASPI_TYPE_DOUBLE
+                                   , GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+    if (iProc == 0) {
+      printf("%10.6f \t", t_max);
+      printf("%6.2f \t", (double) num_included / numIters);
+    }
+  }
+
+  if (iProc == 0) {
+    printf("\n");
+  }
+
+  // late contributions may still arrive in the temporary segment
+  SUCCESS_OR_DIE( gaspi_barrier(GASPI_GROUP_ALL, GASPI_BLOCK) );
+
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_send_id) );
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_recv_id) );
+  SUCCESS_OR_DIE( gaspi_segment_delete(segment_tmp_id) );
+  
+  wait_for_flush_queues();
+}
+
 
 int main(int argc, char** argv) {
 
-  if ((argc < 3) || (argc > 4)) {
+  if ((argc < 3) || (argc > 5)) {
     std::cerr << argv[0] << ": Usage " << argv[0] << " <length in elements>"
-              << " <num iterations> [check]"
+              << " <num iterations> [check] [threshold|knomial|roots|quorum]"
               << std::endl;
     return -1;
   }
@@ -311,11 +615,25 @@ int main(int argc, char** argv) {
 
   static const int VLEN = atoi(argv[1]);
   const int numIters = atoi(argv[2]);
-  const bool checkRes = (argc==4)?true:false;
+  bool checkRes = false;
+  std::string mode = "threshold";
+  for (int i = 3; i < argc; i++) {
+    if (std::string(argv[i]) == "check")
+      checkRes = true;
+    else
+      mode = argv[i];
+  }
 
   //test_reduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
 
-  test_evnt_consist_reduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
+  if (mode == "roots")
+    test_reduce_roots<double>(Operation::SUM, VLEN, numIters, checkRes); 
+  else if (mode == "knomial")
+    test_reduce_knomial<double>(Operation::SUM, VLEN, numIters, checkRes); 
+  else if (mode == "quorum")
+    test_reduce_quorum<double>(Operation::SUM, VLEN, numIters, checkRes); 
+  else
+    test_evnt_consist_reduce<double>(Operation::SUM, VLEN, numIters, checkRes); 
  
   SUCCESS_OR_DIE( gaspi_proc_term(GASPI_BLOCK) );
 
@@ -5,6 +5,8 @@
 #include <GASPI.h>
 
 #include "DataStructsAndOps.hxx"
+#include "Communicator.hxx"
+#include "Request.hxx"
 
 /** Segmented pipeline ring implementation
  *
@@ -16,6 +18,7 @@
  * @param datatype Type of data (see gaspi_datatype_t)
  * @param queue_id Queue id
  * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout
@@ -26,6 +29,736 @@ gaspi_ring_allreduce (const segmentBuffer buffer_send,
                       const gaspi_number_t elem_cnt,
                       const Operation & op,
                       const gaspi_queue_id_t queue_id,
-                      const gaspi_timeout_t timeout);
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent segmented pipeline ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent segmented pipeline ring implementation with sub-block pipelining
+ *
+ * Every chunk is split into sub-blocks with separate notifications, so that the
+ * reduction of a sub-block overlaps with the transfers of its neighbours.
+ * The sub-blocks are enlarged if their notifications do not fit into the
+ * largest free window of notification ids.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param subblock_elem_cnt The number of data elements per sub-block
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_number_t subblock_elem_cnt,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Double-buffered segmented pipeline ring implementation
+ *
+ * The chunks are received in two slots of a workspace segment
+ * which uses the last segment id (gaspi_segment_max - 1), so the application
+ * must not use it. A process only waits before it overwrites a slot which has
+ * not been consumed yet. The results are bitwise identical to gaspi_ring_allreduce.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_buffered (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent double-buffered segmented pipeline ring implementation
+ *
+ * The chunks are received in two slots of a workspace segment
+ * which uses the last segment id (gaspi_segment_max - 1), so the application
+ * must not use it. A process only waits before it overwrites a slot which has
+ * not been consumed yet. The results are bitwise identical to gaspi_ring_allreduce.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_buffered (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_double threshold,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm = gaspi_comm_world());
+
+/** Multi-ring implementation
+ *
+ * The data is split into num_rings parts which are reduced at the same time by
+ * rings running in alternating directions on separate queues.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param num_rings The number of rings (2 gives the bidirectional ring)
+ * @param queue_id Queue id of the first ring, ring r uses the queue (queue_id + r) % gaspi_queue_num
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_multi_ring_allreduce (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_number_t num_rings,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent multi-ring implementation
+ *
+ * The data is split into num_rings parts which are reduced at the same time by
+ * rings running in alternating directions on separate queues.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param num_rings The number of rings (2 gives the bidirectional ring)
+ * @param queue_id Queue id of the first ring, ring r uses the queue (queue_id + r) % gaspi_queue_num
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_multi_ring_allreduce (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double threshold,
+                            const gaspi_number_t num_rings,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm = gaspi_comm_world());
+
+/** Hierarchical node-aware implementation
+ *
+ * The data is reduced on every node by its leader, the leaders reduce the
+ * partial results with a ring and broadcast the result on their node. The
+ * nodes are detected on the first call, which therefore is collective over
+ * GASPI_GROUP_ALL. The data of the processes of a node is received in a
+ * workspace segment which uses the last segment id.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_hierarchical_allreduce (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent hierarchical node-aware implementation
+ *
+ * The data is reduced on every node by its leader, the leaders reduce the
+ * partial results with a ring and broadcast the result on their node. The
+ * nodes are detected on the first call, which therefore is collective over
+ * GASPI_GROUP_ALL. The data of the processes of a node is received in a
+ * workspace segment which uses the last segment id.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_hierarchical_allreduce (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm = gaspi_comm_world());
+
+/** 2D torus implementation
+ *
+ * The processes are laid out as a grid of rows x (nProc / rows) processes. The
+ * data is reduce-scattered along the rows, allreduced along the columns and
+ * allgathered along the rows, so that O(rows + columns) steps are needed. A
+ * tree dimension uses recursive halving and doubling if its number of
+ * processes is a power of two, and a ring otherwise. The data of the peers is
+ * received in a workspace segment which uses the last segment id.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param rows The number of rows, which has to divide nProc, or 0 for the divisor closest to sqrt(nProc)
+ * @param row_algorithm The algorithm along the rows (GRID_RING or GRID_TREE)
+ * @param col_algorithm The algorithm along the columns (GRID_RING or GRID_TREE)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_torus_allreduce (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_number_t rows,
+                       const GridAlgorithm row_algorithm,
+                       const GridAlgorithm col_algorithm,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent 2D torus implementation
+ *
+ * The processes are laid out as a grid of rows x (nProc / rows) processes. The
+ * data is reduce-scattered along the rows, allreduced along the columns and
+ * allgathered along the rows, so that O(rows + columns) steps are needed. A
+ * tree dimension uses recursive halving and doubling if its number of
+ * processes is a power of two, and a ring otherwise. The data of the peers is
+ * received in a workspace segment which uses the last segment id.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param rows The number of rows, which has to divide nProc, or 0 for the divisor closest to sqrt(nProc)
+ * @param row_algorithm The algorithm along the rows (GRID_RING or GRID_TREE)
+ * @param col_algorithm The algorithm along the columns (GRID_RING or GRID_TREE)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_torus_allreduce (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_double threshold,
+                       const gaspi_number_t rows,
+                       const GridAlgorithm row_algorithm,
+                       const GridAlgorithm col_algorithm,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm = gaspi_comm_world());
+
+/** Plan of a persistent segmented pipeline ring implementation
+ *
+ * The chunks and the notifications are computed once, every gaspi_request_start
+ * runs the allreduce, which is completed by gaspi_request_test or gaspi_request_wait.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_init (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_queue_id_t queue_id,
+                           collRequest & request,
+                           const collComm & comm = gaspi_comm_world());
+
+/** Plan of a weakly consistent persistent segmented pipeline ring implementation
+ *
+ * The chunks and the notifications are computed once, every gaspi_request_start
+ * runs the allreduce, which is completed by gaspi_request_test or gaspi_request_wait.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_init (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double threshold,
+                           const gaspi_queue_id_t queue_id,
+                           collRequest & request,
+                           const collComm & comm = gaspi_comm_world());
+
+/** Nonblocking segmented pipeline ring implementation
+ *
+ * The collective is started by the call and advanced by gaspi_request_test and
+ * gaspi_request_wait. The buffers must not be used before it has completed.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param request The request of the collective
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_iallreduce (const segmentBuffer buffer_send,
+                  segmentBuffer buffer_receive,
+                  const gaspi_number_t elem_cnt,
+                  const Operation & op,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent nonblocking segmented pipeline ring implementation
+ *
+ * The collective is started by the call and advanced by gaspi_request_test and
+ * gaspi_request_wait. The buffers must not be used before it has completed.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param request The request of the collective
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_iallreduce (const segmentBuffer buffer_send,
+                  segmentBuffer buffer_receive,
+                  const gaspi_number_t elem_cnt,
+                  const Operation & op,
+                  const gaspi_double threshold,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm = gaspi_comm_world());
+
+/** Binomial tree implementation: reduce to the process 0 followed by a broadcast
+ *
+ * The offset of buffer_receive has to be a multiple of the type size, since
+ * the broadcast addresses the data in elements.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_tree_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent binomial tree implementation: reduce to the process 0 followed by a broadcast
+ *
+ * Only the first ceil(elem_cnt * threshold) elements are reduced by the
+ * threshold gaspi_reduce and broadcast by the threshold gaspi_bcast.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_tree_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Recursive doubling implementation for small messages (log2(nProc) steps)
+ *
+ * The data of the peers is received in a workspace segment which uses the
+ * last segment id (gaspi_segment_max - 1), so the application must not use it.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_recursive_doubling_allreduce (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent recursive doubling implementation for small messages (log2(nProc) steps)
+ *
+ * The data of the peers is received in a workspace segment which uses the
+ * last segment id (gaspi_segment_max - 1), so the application must not use it.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_recursive_doubling_allreduce (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm = gaspi_comm_world());
+
+/** Rabenseifner implementation (recursive halving reduce-scatter and
+ * recursive doubling allgather) for large messages (2*log2(nProc) steps)
+ *
+ * The data of the peers is received in a workspace segment which uses the
+ * last segment id (gaspi_segment_max - 1), so the application must not use it.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_rabenseifner_allreduce (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent Rabenseifner implementation (recursive halving reduce-scatter and
+ * recursive doubling allgather) for large messages (2*log2(nProc) steps)
+ *
+ * The data of the peers is received in a workspace segment which uses the
+ * last segment id (gaspi_segment_max - 1), so the application must not use it.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_rabenseifner_allreduce (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm = gaspi_comm_world());
+
+/** Time-budget allreduce that reduces the data chunk by chunk with the ring
+ *
+ * Before every chunk the processes agree whether any of them has used up the
+ * budget since the start of the call, in which case all of them stop. The
+ * number of leading elements which have been reduced is returned in
+ * completed and is the same on all processes.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param chunk_elem_cnt The number of data elements per chunk
+ * @param budget_ms Time in milliseconds after which no further chunk is started (or GASPI_BLOCK for all chunks)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param completed The number of leading elements which have been reduced
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_allreduce_budget (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_number_t chunk_elem_cnt,
+                        const gaspi_timeout_t budget_ms,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout_ms,
+                        gaspi_number_t & completed,
+                        const collComm & comm = gaspi_comm_world());
+
+/** Sparse allreduce of the k elements with the largest magnitude per process
+ *
+ * Every process selects the k elements of its data with the largest
+ * magnitude and sends them as (index, value) pairs. The pairs of the same
+ * index are reduced with op, the elements which no process has selected are
+ * zero in buffer_receive. SPARSE_ALLGATHER gathers the pairs of all processes
+ * and reduces all of them. SPARSE_TREE merges the pairs along a binomial tree
+ * and keeps only the k largest elements of every merged list, so every
+ * process sends k pairs and the result holds the k largest elements of the
+ * merged data. The result is the same on all processes.
+ *
+ * The pairs are received in the workspace segment, nProc lists of k pairs
+ * for SPARSE_ALLGATHER and log2(nProc) + 1 for SPARSE_TREE.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param k The number of elements which every process selects
+ * @param algorithm The exchange of the selected elements (SPARSE_ALLGATHER or SPARSE_TREE)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_topk_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t k,
+                      const SparseAlgorithm algorithm,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout_ms,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Sparse allreduce of the k largest elements with error feedback
+ *
+ * The residual keeps the part of the data which has not been reduced yet.
+ * Every call adds the data to the residual, sums up the k elements of the
+ * residual with the largest magnitude with gaspi_topk_allreduce and clears
+ * the elements of the residual which have reached the result, so the
+ * elements which are not selected are carried over to the next calls
+ * instead of being lost. The residual has to be zero before the first call.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_residual Segment with offset of the residual of the process (elem_cnt elements)
+ * @param elem_cnt Number of data elements in the buffer
+ * @param k The number of elements which every process selects
+ * @param algorithm The exchange of the selected elements (SPARSE_ALLGATHER or SPARSE_TREE)
+ * @param queue_id Queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_topk_allreduce_feedback (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               segmentBuffer buffer_residual,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_number_t k,
+                               const SparseAlgorithm algorithm,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout_ms,
+                               const collComm & comm = gaspi_comm_world());
+
+/** Plan of a bounded-staleness allreduce
+ *
+ * The allreduce lets the processes go on with a result which is up to
+ * staleness iterations old instead of waiting for the slowest process in
+ * every iteration. It keeps staleness + 1 buffers in buffer_tmp, each with a
+ * persistent ring allreduce as gaspi_ring_allreduce_init, which reserve
+ * (staleness + 1) windows of 2 * nProc - 1 notification ids of the
+ * communicator on the segment of buffer_tmp until stale is destroyed or
+ * planned again.
+ *
+ * @param buffer_send Segment with offset of the data, which is read by every gaspi_stale_allreduce
+ * @param buffer_tmp Segment with offset of the buffers (2 * (staleness + 1) * elem_cnt elements)
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param staleness The largest number of iterations by which a result may be older than the data
+ * @param queue_id Queue id
+ * @param stale The state of the allreduce, which is used by gaspi_stale_allreduce
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_stale_allreduce_init (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_tmp,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_number_t staleness,
+                            const gaspi_queue_id_t queue_id,
+                            collStale & stale,
+                            const collComm & comm = gaspi_comm_world());
+
+/** Bounded-staleness allreduce
+ *
+ * Every call is one iteration: it starts the ring allreduce of the current
+ * data of buffer_send and returns the result of the latest iteration whose
+ * ring has completed, which is at most staleness iterations old. The call
+ * only waits if no such result is available, i.e. if a process is more than
+ * staleness iterations behind. The processes have to call it equally often.
+ *
+ * @param stale The state of the allreduce
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param version The iteration (the number of the call, from 0) whose data has been reduced
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+gaspi_return_t 
+gaspi_stale_allreduce (collStale & stale,
+                       segmentBuffer buffer_receive,
+                       gaspi_number_t & version,
+                       const gaspi_timeout_t timeout_ms);
+
+/** Complete the rings of a bounded-staleness allreduce which are in progress
+ *
+ * @param stale The state of the allreduce
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+gaspi_return_t 
+gaspi_stale_allreduce_wait (collStale & stale,
+                            const gaspi_timeout_t timeout_ms);
 
 #endif // #define ALLREDUCE_H
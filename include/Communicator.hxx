@@ -0,0 +1,104 @@
+#ifndef COMMUNICATOR_H
+#define COMMUNICATOR_H
+
+#include <vector>
+
+#include <GASPI.h>
+
+// structure for a group of processes which run collectives together. The
+// collectives address the processes by their rank in the communicator, which
+// is translated to the GASPI rank with ranks. They only use the notification
+// ids [notification_offset, notification_offset + notification_range) and the
+// workspace segment of the communicator, so collectives on communicators with
+// separate notification ranges can be in progress at the same time
+struct collComm {
+    gaspi_group_t group;
+    std::vector<gaspi_rank_t> ranks;
+    gaspi_rank_t rank;
+    gaspi_rank_t size;
+    gaspi_notification_id_t notification_offset;
+    gaspi_number_t notification_range;
+    gaspi_segment_id_t workspace;
+
+    // topology: the ranks of the members on the node of the calling process
+    // and of the node leaders (the member with the lowest rank on a node) in
+    // ascending order, and the largest number of members on a node
+    std::vector<gaspi_rank_t> local_ranks;
+    std::vector<gaspi_rank_t> leaders;
+    gaspi_number_t max_local;
+
+    // striping: writes of at least 2 * stripe_size bytes are split into stripes
+    // of at least stripe_size bytes on up to stripe_queues consecutive queues
+    gaspi_number_t stripe_queues;
+    gaspi_size_t stripe_size;
+};
+
+/** Communicator of all processes
+ *
+ * It is created on the first call, which is collective over GASPI_GROUP_ALL.
+ * It uses all notification ids and the workspace segment with the last
+ * segment id.
+ *
+ * @return The communicator of all processes
+ */
+collComm &
+gaspi_comm_world ();
+
+/** Create a communicator of a subset of the processes
+ *
+ * The call is collective over the processes in ranks, which all have to pass
+ * the same arguments. The segments of the collectives have to be registered
+ * with the members of the communicator.
+ *
+ * @param ranks The GASPI ranks of the members, the rank in the communicator is the position in ranks
+ * @param num_ranks The number of members
+ * @param notification_offset The first notification id of the collectives
+ * @param notification_range The number of notification ids of the collectives
+ * @param workspace The id of the workspace segment, which is created by the collectives that need it
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The new communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+gaspi_return_t
+gaspi_comm_create (const gaspi_rank_t *ranks,
+                   const gaspi_number_t num_ranks,
+                   const gaspi_notification_id_t notification_offset,
+                   const gaspi_number_t notification_range,
+                   const gaspi_segment_id_t workspace,
+                   const gaspi_timeout_t timeout_ms,
+                   collComm & comm);
+
+/** Delete a communicator which has been created by gaspi_comm_create
+ *
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+gaspi_return_t
+gaspi_comm_delete (collComm & comm);
+
+/** Stripe the large writes of the collectives across several queues
+ *
+ * A striped write posts its stripes on the queue of the collective and the
+ * following ones (modulo gaspi_queue_num), waits for the other queues and
+ * sends the notification on the queue of the collective, so the notification
+ * is only delivered after all stripes have arrived. Only the sender is
+ * concerned, the receivers wait for the notification as before. The
+ * communicators are created with a single queue, i.e. without striping.
+ *
+ * @param comm The communicator
+ * @param num_queues The largest number of queues of a write
+ * @param stripe_size The smallest number of bytes of a stripe
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+gaspi_return_t
+gaspi_comm_striping (collComm & comm,
+                     const gaspi_number_t num_queues,
+                     const gaspi_size_t stripe_size);
+
+#endif // #define COMMUNICATOR_H
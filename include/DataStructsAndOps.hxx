@@ -2,6 +2,8 @@
 #ifndef DATA_STRUCTS_AND_OPS_H
 #define DATA_STRUCTS_AND_OPS_H
 
+#include <stdexcept>
+
 #include <GASPI.h>
 
 #define MAX(a,b)  (((a)<(b)) ? (b) : (a))
@@ -14,6 +16,18 @@ enum Operation { SUM
                 , MAX
                 , MIN };
 
+/**
+ * Algorithms along one dimension of a process grid
+ */
+enum GridAlgorithm { GRID_RING
+                   , GRID_TREE };
+
+/**
+ * Exchange of the selected elements of the sparse allreduce
+ */
+enum SparseAlgorithm { SPARSE_ALLGATHER
+                     , SPARSE_TREE };
+
 // structure for segment and offset
 struct segmentBuffer {
     gaspi_segment_id_t segment;
@@ -5,6 +5,8 @@
 #include <GASPI.h>
 
 #include "DataStructsAndOps.hxx"
+#include "Communicator.hxx"
+#include "Request.hxx"
 
 
 /** Broadcast collective operation that is based on (n-1) straight gaspi_write
@@ -14,6 +16,7 @@
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -23,7 +26,8 @@ gaspi_bcast_simple (segmentBuffer const buffer,
                     const gaspi_number_t elem_cnt,
                     const gaspi_number_t root,
                     const gaspi_queue_id_t queue_id,
-                    const gaspi_timeout_t timeout_ms);
+                    const gaspi_timeout_t timeout_ms,
+                    const collComm & comm = gaspi_comm_world());
 
 /** Weakly consistent broadcast collective operation that is based on (n-1) straight gaspi_write
  *
@@ -33,6 +37,7 @@ gaspi_bcast_simple (segmentBuffer const buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -43,7 +48,73 @@ gaspi_bcast_simple (segmentBuffer const buffer,
                     const gaspi_double threshold,
                     const gaspi_number_t root,
                     const gaspi_queue_id_t queue_id,
-                    const gaspi_timeout_t timeout_ms);
+                    const gaspi_timeout_t timeout_ms,
+                    const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent broadcast collective operation that is based on (n-1) straight gaspi_write with a rotating window
+ *
+ * Every call covers a window of ceil(elem_cnt*threshold) elements, which
+ * starts where the window of the previous iteration ended and wraps around at
+ * the end of the data, so every element is synchronized once every
+ * ceil(1/threshold) iterations. All processes have to pass the same iteration.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, e.g. the training step, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_simple_window (segmentBuffer const buffer,
+                           const gaspi_number_t elem_cnt,
+                           const gaspi_double threshold,
+                           const gaspi_number_t iteration,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout_ms,
+                           const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent broadcast collective operation that is based on straight gaspi_write of pseudo-random blocks
+ *
+ * The data is split into blocks of block_elem_cnt elements, and every call
+ * broadcasts ceil(num_blocks*threshold) of them, which are drawn without
+ * replacement by a generator that is seeded with seed and iteration. All
+ * processes pass the same seed and iteration and draw the same blocks, so no
+ * indices are sent. Unlike the leading elements of the threshold broadcast,
+ * every block is equally likely to be synchronized in a call. Every block is
+ * sent with a separate gaspi_write.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param block_elem_cnt The number of data elements of a block
+ * @param threshold The fraction of the blocks which are broadcast. The value is in [0, 1]
+ * @param seed The seed of the drawing, which is the same on all processes
+ * @param iteration The number of the call, e.g. the training step, which selects the blocks together with the seed
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_simple_sampled (segmentBuffer const buffer,
+                            const gaspi_number_t elem_cnt,
+                            const gaspi_number_t block_elem_cnt,
+                            const gaspi_double threshold,
+                            const gaspi_number_t seed,
+                            const gaspi_number_t iteration,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout_ms,
+                            const collComm & comm = gaspi_comm_world());
 
 /** Broadcast collective operation that uses binomial tree
  *
@@ -52,6 +123,7 @@ gaspi_bcast_simple (segmentBuffer const buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -61,7 +133,8 @@ gaspi_bcast (segmentBuffer const buffer,
 	         const gaspi_number_t elem_cnt,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout_ms);
+             const gaspi_timeout_t timeout_ms,
+             const collComm & comm = gaspi_comm_world());
 
 /** Weakly consistent broadcast collective operation that uses binomial tree.
  *
@@ -71,6 +144,7 @@ gaspi_bcast (segmentBuffer const buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -81,7 +155,298 @@ gaspi_bcast (segmentBuffer const buffer,
              const gaspi_double threshold,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout_ms);
+             const gaspi_timeout_t timeout_ms,
+             const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent broadcast collective operation that uses binomial tree with a rotating window
+ *
+ * The windows rotate with the iteration as in gaspi_bcast_simple_window.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, e.g. the training step, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_window (segmentBuffer const buffer,
+                    const gaspi_number_t elem_cnt,
+                    const gaspi_double threshold,
+                    const gaspi_number_t iteration,
+                    const gaspi_number_t root,
+                    const gaspi_queue_id_t queue_id,
+                    const gaspi_timeout_t timeout_ms,
+                    const collComm & comm = gaspi_comm_world());
+
+/** Pipelined broadcast collective operation that uses binomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param chunk_elem_cnt The number of data elements per pipeline chunk
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_pipelined (segmentBuffer const buffer,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_number_t chunk_elem_cnt,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout_ms,
+                       const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent pipelined broadcast collective operation that uses binomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param chunk_elem_cnt The number of data elements per pipeline chunk
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_pipelined (segmentBuffer const buffer,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_double threshold,
+                       const gaspi_number_t chunk_elem_cnt,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout_ms,
+                       const collComm & comm = gaspi_comm_world());
+
+/** Time-budget broadcast collective operation that uses a pipelined binomial tree.
+ *
+ * The root sends one chunk after the other as long as the budget has not
+ * been used up since the start of the call, and then tells the tree to stop.
+ * All processes receive the same leading chunks, whose number of elements is
+ * returned in completed. The processes down the tree finish about one chunk
+ * per level after the root.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param chunk_elem_cnt The number of data elements per pipeline chunk
+ * @param budget_ms Time in milliseconds the root sends chunks (or GASPI_BLOCK for all chunks)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param completed The number of leading elements which have been broadcast
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_budget (segmentBuffer const buffer,
+                    const gaspi_number_t elem_cnt,
+                    const gaspi_number_t chunk_elem_cnt,
+                    const gaspi_timeout_t budget_ms,
+                    const gaspi_number_t root,
+                    const gaspi_queue_id_t queue_id,
+                    const gaspi_timeout_t timeout_ms,
+                    gaspi_number_t & completed,
+                    const collComm & comm = gaspi_comm_world());
+
+/** Broadcast collective operation that scatters the data along a binomial tree
+ * and gathers it back with a ring (van de Geijn). Suited for large messages.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_scatter_allgather (segmentBuffer const buffer,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_number_t root,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout_ms,
+                               const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent broadcast collective operation that scatters the data along
+ * a binomial tree and gathers it back with a ring (van de Geijn).
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_scatter_allgather (segmentBuffer const buffer,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_double threshold,
+                               const gaspi_number_t root,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout_ms,
+                               const collComm & comm = gaspi_comm_world());
+
+/** Broadcast collective operation that uses k-nomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_knomial (segmentBuffer const buffer,
+                     const gaspi_number_t elem_cnt,
+                     const gaspi_number_t radix,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout_ms,
+                     const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent broadcast collective operation that uses k-nomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_knomial (segmentBuffer const buffer,
+                     const gaspi_number_t elem_cnt,
+                     const gaspi_double threshold,
+                     const gaspi_number_t radix,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout_ms,
+                     const collComm & comm = gaspi_comm_world());
+
+/** Plan of a persistent broadcast collective operation that uses binomial tree.
+ *
+ * The tree and the notifications are computed once, every gaspi_request_start
+ * runs the broadcast, which is completed by gaspi_request_test or gaspi_request_wait.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_init (segmentBuffer const buffer,
+                  const gaspi_number_t elem_cnt,
+                  const gaspi_number_t root,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm = gaspi_comm_world());
+
+/** Plan of a weakly consistent persistent broadcast collective operation that uses binomial tree.
+ *
+ * The tree and the notifications are computed once, every gaspi_request_start
+ * runs the broadcast, which is completed by gaspi_request_test or gaspi_request_wait.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_init (segmentBuffer const buffer,
+                  const gaspi_number_t elem_cnt,
+                  const gaspi_double threshold,
+                  const gaspi_number_t root,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm = gaspi_comm_world());
+
+/** Nonblocking broadcast collective operation that uses binomial tree.
+ *
+ * The collective is started by the call and advanced by gaspi_request_test and
+ * gaspi_request_wait. The buffer must not be modified before it has completed.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request of the collective
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ibcast (segmentBuffer const buffer,
+              const gaspi_number_t elem_cnt,
+              const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+              collRequest & request,
+              const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent nonblocking broadcast collective operation that uses binomial tree.
+ *
+ * The collective is started by the call and advanced by gaspi_request_test and
+ * gaspi_request_wait. The buffer must not be modified before it has completed.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request of the collective
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ibcast (segmentBuffer const buffer,
+              const gaspi_number_t elem_cnt,
+              const gaspi_double threshold,
+              const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+              collRequest & request,
+              const collComm & comm = gaspi_comm_world());
 
 /** Reduce collective operation that implements binomial tree
  *
@@ -91,6 +456,7 @@ gaspi_bcast (segmentBuffer const buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -102,7 +468,8 @@ gaspi_reduce (const segmentBuffer buffer_send,
               const Operation & op,
               const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-              const gaspi_timeout_t timeout_ms);
+              const gaspi_timeout_t timeout_ms,
+              const collComm & comm = gaspi_comm_world());
 
 /** Weakly consistent reduce collective operation that implements binomial tree
  *
@@ -114,6 +481,7 @@ gaspi_reduce (const segmentBuffer buffer_send,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -126,6 +494,448 @@ gaspi_reduce (const segmentBuffer buffer_send,
               const gaspi_double threshold,
               const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-              const gaspi_timeout_t timeout_ms);
+              const gaspi_timeout_t timeout_ms,
+              const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent reduce collective operation that implements binomial tree with a rotating window
+ *
+ * The windows rotate with the iteration as in gaspi_bcast_simple_window.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, e.g. the training step, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_window (const segmentBuffer buffer_send,
+                     segmentBuffer buffer_receive,
+                     const gaspi_number_t elem_cnt,
+                     const Operation & op,
+                     const gaspi_double threshold,
+                     const gaspi_number_t iteration,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout_ms,
+                     const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent reduce collective operation that implements binomial tree on pseudo-random blocks
+ *
+ * The blocks are drawn as in gaspi_bcast_simple_sampled, and only the drawn
+ * blocks of buffer_receive hold the result on the root.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param block_elem_cnt The number of data elements of a block
+ * @param threshold The fraction of the blocks which are reduced. The value is in [0, 1]
+ * @param seed The seed of the drawing, which is the same on all processes
+ * @param iteration The number of the call, e.g. the training step, which selects the blocks together with the seed
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_sampled (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t block_elem_cnt,
+                      const gaspi_double threshold,
+                      const gaspi_number_t seed,
+                      const gaspi_number_t iteration,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout_ms,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent sum of the leading elements with error feedback
+ *
+ * The threshold reduce drops the contribution of the elements beyond the
+ * leading ceil(elem_cnt * threshold) ones. Here every call adds the data to
+ * the residual of the process, sums up the leading elements of the residual
+ * with gaspi_reduce and clears them, so the remaining elements are carried
+ * over to the next call. The residual has to be zero before the first call.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_residual Segment with offset of the residual of the process (elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_feedback (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       segmentBuffer buffer_residual,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_double threshold,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout_ms,
+                       const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent sum of a rotating window with error feedback
+ *
+ * As gaspi_reduce_feedback, but the window of gaspi_reduce_window is
+ * summed up and cleared, so an element collects the data of all the calls
+ * since its last window.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_residual Segment with offset of the residual of the process (elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, e.g. the training step, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_window_feedback (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              segmentBuffer buffer_residual,
+                              const gaspi_number_t elem_cnt,
+                              const gaspi_double threshold,
+                              const gaspi_number_t iteration,
+                              const gaspi_number_t root,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout_ms,
+                              const collComm & comm = gaspi_comm_world());
+
+/** Reduce collective operation that implements k-nomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data ((radix-1)*elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_knomial (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      segmentBuffer buffer_tmp,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t radix,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout_ms,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent reduce collective operation that implements k-nomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data ((radix-1)*elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_knomial (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      segmentBuffer buffer_tmp,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_number_t radix,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout_ms,
+                      const collComm & comm = gaspi_comm_world());
+
+/** Quorum reduce collective operation that implements binomial tree
+ *
+ * Every process waits for the contributions of its children until all have
+ * arrived, or until the deadline has passed and the contributions cover the
+ * quorum of the processes in its subtree. A contribution which arrives later
+ * is dropped. The root reports the processes whose data has been reduced.
+ * Late contributions can arrive at any time, so the first call reserves a
+ * window of notification ids on the segment of buffer_tmp for good.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data (ceil(log2(nProc))+1 slots of elem_cnt elements and nProc ints, each rounded up to 8 bytes)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline_ms Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced, only set at the root
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_quorum (const segmentBuffer buffer_send,
+                     segmentBuffer buffer_receive,
+                     segmentBuffer buffer_tmp,
+                     const gaspi_number_t elem_cnt,
+                     const Operation & op,
+                     const gaspi_double quorum,
+                     const gaspi_timeout_t deadline_ms,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout_ms,
+                     std::vector<gaspi_rank_t> & included,
+                     const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent quorum reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data (ceil(log2(nProc))+1 slots of elem_cnt elements and nProc ints, each rounded up to 8 bytes)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline_ms Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced, only set at the root
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_quorum (const segmentBuffer buffer_send,
+                     segmentBuffer buffer_receive,
+                     segmentBuffer buffer_tmp,
+                     const gaspi_number_t elem_cnt,
+                     const Operation & op,
+                     const gaspi_double threshold,
+                     const gaspi_double quorum,
+                     const gaspi_timeout_t deadline_ms,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout_ms,
+                     std::vector<gaspi_rank_t> & included,
+                     const collComm & comm = gaspi_comm_world());
+
+/** Quorum allreduce collective operation
+ *
+ * The data is reduced with the quorum reduce at the process 0 and broadcast
+ * with the binomial tree together with the ranks of the processes whose data
+ * has been reduced. The list of ranks passes through the workspace segment of
+ * the communicator.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data of the quorum reduce
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline_ms Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_allreduce_quorum (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        segmentBuffer buffer_tmp,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_double quorum,
+                        const gaspi_timeout_t deadline_ms,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout_ms,
+                        std::vector<gaspi_rank_t> & included,
+                        const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent quorum allreduce collective operation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data of the quorum reduce
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline_ms Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param queue_id The queue id
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_allreduce_quorum (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        segmentBuffer buffer_tmp,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_double threshold,
+                        const gaspi_double quorum,
+                        const gaspi_timeout_t deadline_ms,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout_ms,
+                        std::vector<gaspi_rank_t> & included,
+                        const collComm & comm = gaspi_comm_world());
+
+/** Plan of a persistent reduce collective operation that implements binomial tree
+ *
+ * The tree, the notifications and the temporary buffer are set up once, every
+ * gaspi_request_start runs the reduce, which is completed by gaspi_request_test
+ * or gaspi_request_wait.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_init (const segmentBuffer buffer_send,
+                   segmentBuffer buffer_receive,
+                   const gaspi_number_t elem_cnt,
+                   const Operation & op,
+                   const gaspi_number_t root,
+                   const gaspi_queue_id_t queue_id,
+                   collRequest & request,
+                   const collComm & comm = gaspi_comm_world());
+
+/** Plan of a weakly consistent persistent reduce collective operation that implements binomial tree
+ *
+ * The tree, the notifications and the temporary buffer are set up once, every
+ * gaspi_request_start runs the reduce, which is completed by gaspi_request_test
+ * or gaspi_request_wait.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_init (const segmentBuffer buffer_send,
+                   segmentBuffer buffer_receive,
+                   const gaspi_number_t elem_cnt,
+                   const Operation & op,
+                   const gaspi_double threshold,
+                   const gaspi_number_t root,
+                   const gaspi_queue_id_t queue_id,
+                   collRequest & request,
+                   const collComm & comm = gaspi_comm_world());
+
+/** Nonblocking reduce collective operation that implements binomial tree
+ *
+ * The collective is started by the call and advanced by gaspi_request_test and
+ * gaspi_request_wait. The buffers must not be used before it has completed.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request of the collective
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ireduce (const segmentBuffer buffer_send,
+               segmentBuffer buffer_receive,
+               const gaspi_number_t elem_cnt,
+               const Operation & op,
+               const gaspi_number_t root,
+               const gaspi_queue_id_t queue_id,
+               collRequest & request,
+               const collComm & comm = gaspi_comm_world());
+
+/** Weakly consistent nonblocking reduce collective operation that implements binomial tree
+ *
+ * The collective is started by the call and advanced by gaspi_request_test and
+ * gaspi_request_wait. The buffers must not be used before it has completed.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request of the collective
+ * @param comm The communicator, all processes by default
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ireduce (const segmentBuffer buffer_send,
+               segmentBuffer buffer_receive,
+               const gaspi_number_t elem_cnt,
+               const Operation & op,
+               const gaspi_double threshold,
+               const gaspi_number_t root,
+               const gaspi_queue_id_t queue_id,
+               collRequest & request,
+               const collComm & comm = gaspi_comm_world());
 
 #endif //#define EVNT_CONSIST_COLL_H
@@ -0,0 +1,127 @@
+
+#ifndef REQUEST_H
+#define REQUEST_H
+
+#include <vector>
+
+#include <GASPI.h>
+
+#include "DataStructsAndOps.hxx"
+
+/**
+ * Actions of a nonblocking collective
+ */
+enum requestActionType { ACTION_WAIT
+                       , ACTION_WRITE
+                       , ACTION_REDUCE
+                       , ACTION_COPY
+                       , ACTION_FLUSH };
+
+// structure for one action of a nonblocking collective. ACTION_WAIT waits for
+// notification_id on segment_local with the value notification_value,
+// ACTION_WRITE writes size bytes on queue_id (only the notification if size is
+// 0, no notification if notification_value is 0), ACTION_REDUCE reduces cnt
+// elements of src into dst, ACTION_COPY copies size bytes of src to dst and
+// ACTION_FLUSH waits for queue_id
+struct requestAction {
+    requestActionType type;
+    gaspi_queue_id_t queue_id;
+    gaspi_segment_id_t segment_local;
+    gaspi_offset_t offset_local;
+    gaspi_rank_t rank;
+    gaspi_segment_id_t segment_remote;
+    gaspi_offset_t offset_remote;
+    gaspi_size_t size;
+    gaspi_notification_id_t notification_id;
+    gaspi_notification_t notification_value;
+    const void *src;
+    void *dst;
+    unsigned int cnt;
+};
+
+// structure for a window of notification ids of a segment which a request
+// keeps reserved for its collective, relative to the communicator of the group
+struct requestWindow {
+    gaspi_group_t group;
+    gaspi_segment_id_t segment_id;
+    gaspi_notification_id_t first;
+};
+
+// structure for the plan and the state of a nonblocking or persistent collective.
+// It cannot be copied, since the actions may point to tmp. The windows of
+// notification ids of the plan are released once the request is destroyed
+// or planned again
+struct collRequest {
+    std::vector<requestAction> actions;
+    std::size_t next = 0;
+    gaspi_queue_id_t queue_id = 0;
+    Operation op = SUM;
+    void (*reduce)(const Operation &, const unsigned int, const void *, void *) = NULL;
+    std::vector<char> tmp;
+    std::vector<requestWindow> windows;
+
+    collRequest() = default;
+    collRequest(const collRequest &) = delete;
+    collRequest & operator=(const collRequest &) = delete;
+    collRequest(collRequest &&) = default;
+    ~collRequest();
+};
+
+// structure for the state of a bounded-staleness allreduce. Every buffer has a
+// persistent ring allreduce, the iteration whose data it reduces and whether
+// this allreduce is in progress or has completed. The data of the iterations
+// is staged and reduced in tmp, num_ranks is the size of the communicator.
+// It must not be copied, as collRequest
+struct collStale {
+    std::vector<collRequest> requests;
+    std::vector<gaspi_number_t> versions;
+    std::vector<bool> running;
+    std::vector<bool> completed;
+    gaspi_number_t iteration = 0;
+    gaspi_number_t staleness = 0;
+    gaspi_rank_t num_ranks = 0;
+    gaspi_size_t size = 0;
+    const char *src = NULL;
+    char *tmp = NULL;
+};
+
+/** Start a planned collective
+ *
+ * A request which has been planned by one of the init calls can be started
+ * any number of times, but a run has to be completed by gaspi_request_test or
+ * gaspi_request_wait before the next one is started.
+ *
+ * @param request The request of the collective
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+gaspi_return_t 
+gaspi_request_start (collRequest & request);
+
+/** Advance a nonblocking collective as far as possible without blocking
+ *
+ * The collective is resumed where the previous call has stopped, so it can
+ * be polled from the scheduler of the application.
+ *
+ * @param request The request of the collective
+ *
+ * @return GASPI_SUCCESS if the collective has completed, GASPI_TIMEOUT if it
+ * is still in progress, GASPI_ERROR in case of error
+ */
+gaspi_return_t 
+gaspi_request_test (collRequest & request);
+
+/** Wait for a nonblocking collective
+ *
+ * @param request The request of the collective
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ *
+ * @return GASPI_SUCCESS if the collective has completed, GASPI_TIMEOUT if it
+ * is still in progress after the timeout, GASPI_ERROR in case of error
+ */
+gaspi_return_t 
+gaspi_request_wait (collRequest & request,
+                    const gaspi_timeout_t timeout_ms);
+
+#endif // #define REQUEST_H
@@ -1,16 +1,29 @@
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <vector>
 #include <iostream>
 #include <cstring>
+#include <iterator>
+#include <limits>
 
 #include <Allreduce.hxx>
+#include <EvntConsistColl.hxx>
 
-#include "success_or_die.h"
+#include "success_or_return.h"
 #include "testsome.h"
 #include "queue.h"
 #include "waitsome.h"
+#include "partition.h"
+#include "workspace.h"
+#include "ring.h"
+#include "communicator.h"
+#include "notification.h"
+#include "grid.h"
+#include "request.h"
+#include "sparse.h"
 
 /** Segmented pipeline ring implementation
  *
@@ -21,6 +34,7 @@
  * @param datatype Type of data (see gaspi_datatype_t)
  * @param queue_id Queue id
  * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout
@@ -31,44 +45,264 @@ gaspi_ring_allreduce (const segmentBuffer buffer_send,
                       const gaspi_number_t elem_cnt,
                       const Operation & op,
                       const gaspi_queue_id_t queue_id,
-                      const gaspi_timeout_t timeout)
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    return gaspi_ring_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, timeout, comm);
+}
+
+/** Weakly consistent segmented pipeline ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param datatype Type of data (see gaspi_datatype_t)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    // one sub-block per chunk
+    return gaspi_ring_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, threshold, elem_cnt, queue_id, timeout, comm);
+}
+
+/** Weakly consistent segmented pipeline ring implementation with sub-block pipelining
+ *
+ * Every chunk is split into sub-blocks of subblock_elem_cnt elements with separate
+ * notifications, so that the reduction of a sub-block overlaps with the transfer of
+ * the next one and the forwarding of the previous one.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param subblock_elem_cnt The number of data elements per sub-block
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_number_t subblock_elem_cnt,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Partition elements of array into nProc chunks
+    std::vector<unsigned int> segment_sizes, segment_ends;
+    partition_chunks(num_elem, nProc, segment_sizes, segment_ends);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_array, (void*) src_array, num_elem * type_size);
 
     if (nProc <= 1)
         return GASPI_SUCCESS;
 
+    // Receive from left neighbor
+    const int recv_from = (iProc - 1 + nProc) % nProc;
+
+    // Send to right neighbor
+    const int send_to = (iProc + 1) % nProc;
+
+    // scatter-reduce steps followed by allgather steps
+    const int num_steps = 2 * (nProc - 1);
+
+    // every sub-block of every step has its own notification, so enlarge
+    // the sub-blocks if there are not enough notifications
+    gaspi_number_t const notification_num = notification_available(comm, buffer_receive.segment);
+    const int max_blocks_avail = MAX(((int) notification_num - 1) / num_steps, 1);
+    int block_size = MAX(subblock_elem_cnt, 1);
+    int max_blocks = MAX((segment_sizes[0] + block_size - 1) / block_size, 1);
+    if (max_blocks > max_blocks_avail) {
+        block_size = (segment_sizes[0] + max_blocks_avail - 1) / max_blocks_avail;
+        max_blocks = MAX((segment_sizes[0] + block_size - 1) / block_size, 1);
+    }
+
+    // the window holds the ready notification followed by the ones of the sub-blocks
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, 1 + num_steps * max_blocks, &window) );
+
+    // waive that it is ready to receive
+    SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+            , recv_from, window, iProc + 1
+            , queue_id, timeout
+    ) );
+
+    // wait for notification that the data can be sent
+    SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window, send_to + 1, timeout ) );
+
+    // At step t, iProc sends chunk (rank - t) and receives chunk (rank - t - 1);
+    // the first nProc - 1 steps reduce the received chunk (scatter-reduce), the
+    // remaining ones only store it (allgather). Every received sub-block is
+    // forwarded right away in the next step, so the own chunk of the first step
+    // is handled as if it was received in step -1
+    for (int t = -1; t < num_steps; t++) {
+
+        int chunk = (iProc - t - 1 + 2 * nProc) % nProc;
+        int chunk_start = segment_ends[chunk] - segment_sizes[chunk];
+        int num_blocks = MAX((segment_sizes[chunk] + block_size - 1) / block_size, 1);
+
+        for (int k = 0; k < num_blocks; k++) {
+
+            int block_start = chunk_start + k * block_size;
+            int block_cnt = MIN(block_size, (int) segment_ends[chunk] - block_start);
+
+            if (t >= 0) {
+                // wait for notification that the sub-block has arrived
+                gaspi_notification_id_t data_arr = window + 1 + t * max_blocks + k;
+                SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, data_arr, recv_from + 1, timeout ) );
+
+                // local reduce
+                if (t < nProc - 1)
+                    local_reduce<T>(op, block_cnt, &src_array[block_start], &rcv_array[block_start]);
+            }
+
+            if (t + 1 < num_steps) {
+                // forward the sub-block
+                gaspi_notification_id_t data = window + 1 + (t + 1) * max_blocks + k;
+                if (block_cnt > 0) {
+                    SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                            , buffer_receive.offset + block_start * type_size // offset
+                            , send_to, buffer_receive.segment, buffer_receive.offset + block_start * type_size // offset
+                            , block_cnt * type_size, data
+                            , iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
+                            , queue_id, timeout
+                    ) );
+                } else {
+                    // zero sized writes are not allowed, there are less elements than processes
+                    SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                            , send_to, data
+                            , iProc + 1
+                            , queue_id, timeout
+                    ) );
+                }
+            }
+        }
+    }
+
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Double-buffered segmented pipeline ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_buffered (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm)
+{
+    return gaspi_ring_allreduce_buffered<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, timeout, comm);
+}
+
+/** Weakly consistent double-buffered segmented pipeline ring implementation
+ *
+ * The chunks are received in two slots of a workspace segment and the
+ * notification values are the sequence numbers of the steps, so a process
+ * only waits before it overwrites a slot which its right neighbor has not
+ * consumed yet. The chunks are reduced in the same order as in
+ * gaspi_ring_allreduce, i.e. the results are bitwise identical.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_buffered (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_double threshold,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
     // type size
     int type_size = sizeof(T);
 
     // auxiliary pointers
     gaspi_pointer_t src_arr, rcv_arr;
-    SUCCESS_OR_DIE( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
-    SUCCESS_OR_DIE( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
     T *src_array = (T *)((char*)src_arr + buffer_send.offset);
     T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
 
     // Partition elements of array into nProc chunks
-    const unsigned int segment_size = elem_cnt / nProc;
-    std::vector<unsigned int> segment_sizes(nProc, segment_size);
-
-    int segment_residual = elem_cnt % nProc;
-    for (int i = 0; i < segment_residual; i++) 
-        segment_sizes[i]++;
-
-    // Compute where each chunk ends
-    std::vector<unsigned int> segment_ends(nProc);
-    segment_ends[0] = segment_sizes[0];
-    for (int i = 1; i < nProc; i++) 
-        segment_ends[i] = segment_sizes[i] + segment_ends[i-1];
-   
-    // The last segment should end at the end of segment
-    ASSERT (segment_ends[nProc - 1] == elem_cnt);
+    std::vector<unsigned int> segment_sizes, segment_ends;
+    partition_chunks(num_elem, nProc, segment_sizes, segment_ends);
 
     // Copy the data to the output buffer to avoid modifying the input buffer
-    std::memcpy((void*) rcv_array, (void*) src_array, elem_cnt * type_size);
+    std::memcpy((void*) rcv_array, (void*) src_array, num_elem * type_size);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
 
     // Receive from left neighbor
     const int recv_from = (iProc - 1 + nProc) % nProc;
@@ -76,137 +310,2895 @@ gaspi_ring_allreduce (const segmentBuffer buffer_send,
     // Send to right neighbor
     const int send_to = (iProc + 1) % nProc;
 
-    // scatter-reduce phase
-    // At every step, for every rank, we iterate through
-    // segments with wraparound and send and recv from our neighbors and reduce
-    // locally. At the i'th iteration, iProc sends segment (rank - i) and receives
-    // segment (rank - i - 1)
-    for (int i = 0; i < nProc - 1; i++) {
+    // scatter-reduce steps followed by allgather steps
+    const int num_steps = 2 * (nProc - 1);
 
-        int recv_chunk = (iProc - i - 1 + nProc) % nProc;
-        int send_chunk = (iProc - i + nProc) % nProc;
-        
-        // waive that it is ready to receive
-        gaspi_notification_id_t ready = iProc + i;
-        notify_and_wait(buffer_send.segment
-                , recv_from, ready, iProc + 1
+    // the chunk of step t is received in slot t%2. The notification data+s signals
+    // that slot s has been written and the notification credit+s that it can be written
+    const gaspi_size_t slot_size = segment_sizes[0] * type_size;
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, 2 * slot_size, timeout, &tmp_segment, &tmp_arr) );
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, tmp_segment, 4, &window) );
+    const gaspi_notification_id_t data = window;
+    const gaspi_notification_id_t credit = window + 2;
+
+    // waive that both slots are ready to receive the first two steps
+    for (int t = 0; t < 2; t++) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , recv_from, credit + t, t + 1
                 , queue_id, timeout
-        );
+        ) );
+    }
 
-        // wait for notification that the data can be sent
-        gaspi_notification_id_t ready_arr = send_to + i;
-        wait_or_die( buffer_send.segment, ready_arr, send_to + 1 );  
+    // At step t, iProc sends chunk (rank - t) and receives chunk (rank - t - 1);
+    // the first nProc - 1 steps reduce the received chunk (scatter-reduce), the
+    // remaining ones only store it (allgather)
+    for (int t = 0; t < num_steps; t++) {
+
+        int recv_chunk = (iProc - t - 1 + 2 * nProc) % nProc;
+        int send_chunk = (iProc - t + 2 * nProc) % nProc;
+        const int slot = t % 2;
+
+        // wait for notification that the slot of the right neighbor is consumed
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, credit + slot, t + 1, timeout ) );
 
         // write data
         int segment_start = segment_ends[send_chunk] - segment_sizes[send_chunk];
-        gaspi_notification_id_t data = iProc * nProc + send_to + i; 
-        write_notify_and_wait(buffer_receive.segment
-                , buffer_receive.offset + segment_start * type_size // offset
-                , send_to, buffer_receive.segment, buffer_receive.offset + segment_start * type_size // offset
-                , segment_sizes[send_chunk] * type_size, data
-                , i + iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
-                , queue_id, GASPI_BLOCK
-        );
+        if (segment_sizes[send_chunk] > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                    , buffer_receive.offset + segment_start * type_size // offset
+                    , send_to, tmp_segment, slot * slot_size // offset
+                    , segment_sizes[send_chunk] * type_size, data + slot
+                    , t + 1 // notification value: sequence number of the step, +1 to avoid 0
+                    , queue_id, timeout
+            ) );
+        } else {
+            // zero sized writes are not allowed, there are less elements than processes
+            SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                    , send_to, data + slot
+                    , t + 1
+                    , queue_id, timeout
+            ) );
+        }
 
         // wait for notification that the data has arrived
-        gaspi_notification_id_t data_arr = recv_from * nProc + iProc + i;
-        wait_or_die( buffer_receive.segment, data_arr, i + recv_from + 1 );  
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data + slot, t + 1, timeout ) );
 
-        // local reduce
         segment_start = segment_ends[recv_chunk] - segment_sizes[recv_chunk];
-        local_reduce<T>(op, segment_sizes[recv_chunk], &src_array[segment_start], &rcv_array[segment_start]);
+        std::memcpy((void*) &rcv_array[segment_start], (char*) tmp_arr + slot * slot_size
+                   , segment_sizes[recv_chunk] * type_size);
 
-        // ackowledge that the data has arrived
-        gaspi_notification_id_t ack = i + recv_from + 1;
-        notify_and_wait(buffer_receive.segment
-                , recv_from, ack, iProc + 1
-                , queue_id, timeout
-        );
-            
-        // wait for acknowledgement notification
-        gaspi_notification_id_t ack_arr = i + iProc + 1;
-        wait_or_die( buffer_receive.segment, ack_arr, send_to + 1 );  
-    }
-
-    // pipelined ring allgather
-    // At every step, for every rank, we iterate through
-    // segments with wraparound and send and recv from our neighbors.
-    // At the i'th iteration, iProc sends segment (rank + 1 - i) and receives
-    // segment (rank - i)
-    for (int i = 0; i < nProc-1; i++) {
-        
-        int send_chunk = (iProc - i + 1 + nProc) % nProc;
-        
-        // ready to receive
-        gaspi_notification_id_t ready = iProc + i;
-        notify_and_wait(buffer_send.segment
-                , recv_from, ready, iProc + 1
-                , queue_id, timeout
-        );
+        // waive that the slot can be written in step t+2
+        if (t + 2 < num_steps) {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                    , recv_from, credit + slot, t + 3
+                    , queue_id, timeout
+            ) );
+        }
 
-        // wait for notification that the data can be sent
-        gaspi_notification_id_t ready_arr = send_to + i;
-        wait_or_die( buffer_send.segment, ready_arr, send_to + 1 );  
-   
-        // write data 
-        int segment_start = segment_ends[send_chunk] - segment_sizes[send_chunk];
-        gaspi_notification_id_t data = iProc * nProc + send_to + i; 
-        write_notify_and_wait(buffer_receive.segment
-                , buffer_receive.offset + segment_start * type_size // offset
-                , send_to, buffer_receive.segment, buffer_receive.offset + segment_start * type_size // offset 
-                , segment_sizes[send_chunk] * type_size, data
-                , i + iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
-                , queue_id, GASPI_BLOCK
-        );
+        // local reduce
+        if (t < nProc - 1)
+            local_reduce<T>(op, segment_sizes[recv_chunk], &src_array[segment_start], &rcv_array[segment_start]);
+    }
 
-        // wait for notification that the data has arrived
-        gaspi_notification_id_t data_arr = recv_from * nProc + iProc + i;
-        wait_or_die( buffer_receive.segment, data_arr, i + recv_from + 1 );  
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
 
-        // ackowledge that the data has arrived
-        gaspi_notification_id_t ack = i + recv_from + 1;
-        notify_and_wait(buffer_receive.segment
-                , recv_from, ack, iProc + 1
-                , queue_id, timeout
-        );
-            
-        // wait for acknowledgement notification
-        gaspi_notification_id_t ack_arr = i + iProc + 1;
-        wait_or_die( buffer_receive.segment, ack_arr, send_to + 1 );  
+    return GASPI_SUCCESS;
+}
+
+/** Multi-ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param num_rings The number of rings
+ * @param queue_id Queue id of the first ring
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_multi_ring_allreduce (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_number_t num_rings,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm)
+{
+    return gaspi_multi_ring_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, num_rings, queue_id, timeout, comm);
+}
+
+/** Weakly consistent multi-ring implementation
+ *
+ * The data is split into num_rings parts which are reduced at the same time by
+ * separate rings on separate queues. The even rings run clockwise and the odd
+ * ones counter-clockwise, so that both directions of the links are used, and
+ * further pairs of rings visit the processes with other strides.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param num_rings The number of rings
+ * @param queue_id Queue id of the first ring, ring r uses the queue (queue_id + r) % gaspi_queue_num
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_multi_ring_allreduce (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double threshold,
+                            const gaspi_number_t num_rings,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_array, (void*) src_array, num_elem * type_size);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // scatter-reduce steps followed by allgather steps
+    const int num_steps = 2 * (nProc - 1);
+
+    // every ring needs num_steps + 1 notifications
+    gaspi_number_t const notification_num = notification_available(comm, buffer_receive.segment);
+    const int rings = MAX(MIN(num_rings, notification_num / (num_steps + 1)), 1);
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, rings * (num_steps + 1), &window) );
+
+    // Partition elements of array into one part per ring
+    std::vector<unsigned int> part_sizes, part_ends;
+    partition_chunks(num_elem, rings, part_sizes, part_ends);
+
+    // Partition every part into nProc chunks, which are indexed by
+    // the position of the processes in the ring
+    std::vector<std::vector<unsigned int> > segment_sizes(rings), segment_ends(rings);
+    std::vector<gaspi_rank_t> position(rings), send_to(rings), recv_from(rings);
+    std::vector<gaspi_queue_id_t> queue(rings);
+    gaspi_number_t queue_num;
+    SUCCESS_OR_RETURN( gaspi_queue_num(&queue_num) );
+    for (int ring = 0; ring < rings; ring++) {
+        partition_chunks(part_sizes[ring], nProc, segment_sizes[ring], segment_ends[ring]);
+        for (int c = 0; c < nProc; c++) 
+            segment_ends[ring][c] += part_ends[ring] - part_sizes[ring];
+        ring_neighbors(iProc, nProc, ring, position[ring], send_to[ring], recv_from[ring]);
+        queue[ring] = (queue_id + ring) % queue_num;
+    }
+
+    // a ring uses the notification ring*(num_steps+1) of the window to signal that
+    // the process is ready to receive, and the following ones for the data of every step
+    for (int ring = 0; ring < rings; ring++) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                , recv_from[ring], window + ring * (num_steps + 1), iProc + 1
+                , queue[ring], timeout
+        ) );
+    }
+
+    // wait for notification that the data can be sent
+    for (int ring = 0; ring < rings; ring++)
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window + ring * (num_steps + 1), send_to[ring] + 1, timeout ) );
+
+    // At step t, the process at position pos of a ring sends chunk (pos - t) and
+    // receives chunk (pos - t - 1); the first nProc - 1 steps reduce the received
+    // chunk (scatter-reduce), the remaining ones only store it (allgather)
+    for (int t = 0; t < num_steps; t++) {
+
+        // write the data of all rings
+        for (int ring = 0; ring < rings; ring++) {
+            int send_chunk = (position[ring] - t + 2 * nProc) % nProc;
+            int segment_start = segment_ends[ring][send_chunk] - segment_sizes[ring][send_chunk];
+            gaspi_notification_id_t data = window + ring * (num_steps + 1) + 1 + t;
+            if (segment_sizes[ring][send_chunk] > 0) {
+                SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                        , buffer_receive.offset + segment_start * type_size // offset
+                        , send_to[ring], buffer_receive.segment, buffer_receive.offset + segment_start * type_size // offset
+                        , segment_sizes[ring][send_chunk] * type_size, data
+                        , iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
+                        , queue[ring], timeout
+                ) );
+            } else {
+                // zero sized writes are not allowed, there are less elements than processes
+                SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                        , send_to[ring], data
+                        , iProc + 1
+                        , queue[ring], timeout
+                ) );
+            }
+        }
+
+        // receive the data of all rings
+        for (int ring = 0; ring < rings; ring++) {
+            int recv_chunk = (position[ring] - t - 1 + 2 * nProc) % nProc;
+
+            // wait for notification that the data has arrived
+            gaspi_notification_id_t data_arr = window + ring * (num_steps + 1) + 1 + t;
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, data_arr, recv_from[ring] + 1, timeout ) );
+
+            // local reduce
+            if (t < nProc - 1) {
+                int segment_start = segment_ends[ring][recv_chunk] - segment_sizes[ring][recv_chunk];
+                local_reduce<T>(op, segment_sizes[ring][recv_chunk], &src_array[segment_start], &rcv_array[segment_start]);
+            }
+        }
     }
 
+    for (int ring = 0; ring < rings; ring++)
+        SUCCESS_OR_RETURN( gaspi_wait(queue[ring], timeout) );
+
     return GASPI_SUCCESS;
 }
 
-// explicit template instantiation
-template gaspi_return_t 
-gaspi_ring_allreduce<double> (const segmentBuffer buffer_send,
+/** Hierarchical node-aware implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_hierarchical_allreduce (const segmentBuffer buffer_send,
                               segmentBuffer buffer_receive,
                               const gaspi_number_t elem_cnt,
                               const Operation & op,
                               const gaspi_queue_id_t queue_id,
-                              const gaspi_timeout_t timeout);
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm)
+{
+    return gaspi_hierarchical_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, timeout, comm);
+}
 
-template gaspi_return_t 
-gaspi_ring_allreduce<float> (const segmentBuffer buffer_send,
+/** Weakly consistent hierarchical node-aware implementation
+ *
+ * The processes on a node send their data to the node leader, i.e. the
+ * process of the node with the lowest rank, which reduces it in the workspace
+ * segment. The leaders reduce the partial results of the nodes with a ring
+ * and every leader writes the result to the processes of its node, so that
+ * only the ring of the leaders crosses the network. The nodes are detected
+ * by the host names of the processes on the first call.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_hierarchical_allreduce (const segmentBuffer buffer_send,
                               segmentBuffer buffer_receive,
                               const gaspi_number_t elem_cnt,
                               const Operation & op,
+                              const gaspi_double threshold,
                               const gaspi_queue_id_t queue_id,
-                              const gaspi_timeout_t timeout);
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
-template gaspi_return_t 
-gaspi_ring_allreduce<int> (const segmentBuffer buffer_send,
-                              segmentBuffer buffer_receive,
-                              const gaspi_number_t elem_cnt,
-                              const Operation & op,
-                              const gaspi_queue_id_t queue_id,
-                              const gaspi_timeout_t timeout);
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
 
-template gaspi_return_t 
-gaspi_ring_allreduce<unsigned int> (const segmentBuffer buffer_send,
-                              segmentBuffer buffer_receive,
-                              const gaspi_number_t elem_cnt,
-                              const Operation & op,
-                              const gaspi_queue_id_t queue_id,
-                              const gaspi_timeout_t timeout);
+    // type size
+    int type_size = sizeof(T);
+    int segment_size = num_elem * type_size;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_array, (void*) src_array, segment_size);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // processes on the same node and the leaders of all nodes
+    std::vector<gaspi_rank_t> const & local_ranks = comm.local_ranks;
+    std::vector<gaspi_rank_t> const & leaders = comm.leaders;
+    gaspi_number_t const max_local = comm.max_local;
+
+    const int num_local = local_ranks.size();
+    const gaspi_rank_t leader = local_ranks[0];
+
+    // slot 0 of the workspace of a leader holds the partial result of the node
+    // and slot l receives the data of the l-th process of the node. The first
+    // notification of the window signals that the slots are ready and the l-th
+    // one that slot l has been written. All processes request the same size
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, max_local * segment_size, timeout, &tmp_segment, &tmp_arr) );
+    T *tmp_array = (T *) tmp_arr;
+
+    // the window on the receive segment holds the notification of the result followed
+    // by the ones of the ring steps. All processes take the same windows, also if they
+    // do not take part in the ring of the leaders
+    const int nNodes = leaders.size();
+    gaspi_notification_id_t tmp_window, window;
+    SUCCESS_OR_RETURN( notification_window(comm, tmp_segment, max_local, &tmp_window) );
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, 1 + 2 * (nNodes - 1), &window) );
+
+    if (iProc != leader) {
+        const int local = std::find(local_ranks.begin(), local_ranks.end(), iProc) - local_ranks.begin();
+
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, tmp_window, leader + 1, timeout ) );
+
+        if (num_elem > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_send.segment, buffer_send.offset
+                    , leader, tmp_segment, local * segment_size
+                    , segment_size, tmp_window + local, iProc + 1
+                    , queue_id, timeout
+            ) );
+        } else {
+            // zero sized writes are not allowed
+            SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                    , leader, tmp_window + local, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+
+        // wait for the result
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window, leader + 1, timeout ) );
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+        return GASPI_SUCCESS;
+    }
+
+    // waive to the processes of the node that the slots are ready to receive
+    for (int l = 1; l < num_local; l++) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , local_ranks[l], tmp_window, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+
+    // reduce the data of the node
+    std::memcpy((void*) tmp_array, (void*) src_array, segment_size);
+    for (int l = 1; l < num_local; l++) {
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, tmp_window + l, local_ranks[l] + 1, timeout ) );
+        local_reduce<T>(op, num_elem, &tmp_array[l * num_elem], &tmp_array[0]);
+    }
+    std::memcpy((void*) rcv_array, (void*) tmp_array, segment_size);
+
+    if (nNodes > 1) {
+        const int node = std::find(leaders.begin(), leaders.end(), iProc) - leaders.begin();
+
+        // Partition elements of array into nNodes chunks
+        std::vector<unsigned int> segment_sizes, segment_ends;
+        partition_chunks(num_elem, nNodes, segment_sizes, segment_ends);
+
+        // Receive from left and send to right leader
+        const int recv_from = leaders[(node - 1 + nNodes) % nNodes];
+        const int send_to = leaders[(node + 1) % nNodes];
+
+        // scatter-reduce steps followed by allgather steps
+        const int num_steps = 2 * (nNodes - 1);
+
+        // waive that it is ready to receive
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                , recv_from, window, iProc + 1
+                , queue_id, timeout
+        ) );
+
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window, send_to + 1, timeout ) );
+
+        // At step t, the leader sends chunk (node - t) and receives chunk (node - t - 1);
+        // the received chunks are reduced with the partial result of the node in the
+        // first nNodes - 1 steps (scatter-reduce) and only stored in the remaining ones (allgather)
+        for (int t = 0; t < num_steps; t++) {
+
+            int send_chunk = (node - t + 2 * nNodes) % nNodes;
+            int segment_start = segment_ends[send_chunk] - segment_sizes[send_chunk];
+            if (segment_sizes[send_chunk] > 0) {
+                SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                        , buffer_receive.offset + segment_start * type_size // offset
+                        , send_to, buffer_receive.segment, buffer_receive.offset + segment_start * type_size // offset
+                        , segment_sizes[send_chunk] * type_size, window + 1 + t
+                        , iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
+                        , queue_id, timeout
+                ) );
+            } else {
+                // zero sized writes are not allowed, there are less elements than nodes
+                SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                        , send_to, window + 1 + t
+                        , iProc + 1
+                        , queue_id, timeout
+                ) );
+            }
+
+            // wait for notification that the data has arrived
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window + 1 + t, recv_from + 1, timeout ) );
+
+            // local reduce
+            if (t < nNodes - 1) {
+                int recv_chunk = (node - t - 1 + 2 * nNodes) % nNodes;
+                segment_start = segment_ends[recv_chunk] - segment_sizes[recv_chunk];
+                local_reduce<T>(op, segment_sizes[recv_chunk], &tmp_array[segment_start], &rcv_array[segment_start]);
+            }
+        }
+    }
+
+    // write the result to the processes of the node
+    for (int l = 1; l < num_local; l++) {
+        if (num_elem > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment, buffer_receive.offset
+                    , local_ranks[l], buffer_receive.segment, buffer_receive.offset
+                    , segment_size, window, iProc + 1
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                    , local_ranks[l], window, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+    }
+
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** 2D torus implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param rows The number of rows of the process grid, 0 for a grid close to a square
+ * @param row_algorithm The algorithm along the rows (GRID_RING or GRID_TREE)
+ * @param col_algorithm The algorithm along the columns (GRID_RING or GRID_TREE)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_torus_allreduce (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_number_t rows,
+                       const GridAlgorithm row_algorithm,
+                       const GridAlgorithm col_algorithm,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm)
+{
+    return gaspi_torus_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0
+                                   , rows, row_algorithm, col_algorithm, queue_id, timeout, comm);
+}
+
+/** Weakly consistent 2D torus implementation
+ *
+ * The processes are laid out as a grid of rows x (nProc / rows) processes.
+ * The data is reduce-scattered along the rows, every process allreduces its
+ * chunk along its column, and the chunks are allgathered along the rows. With
+ * rings in both dimensions 2*(rows + columns - 2) steps are needed instead
+ * of 2*(nProc - 1), while every process still sends about 2*elem_cnt elements.
+ * The trees use recursive halving and doubling and need log2(rows) or
+ * log2(columns) steps per phase, they are replaced by rings if the number of
+ * processes along the dimension is not a power of two. The data of the
+ * reduce-scatter steps is received in the workspace segment.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param rows The number of rows of the process grid, 0 for a grid close to a square
+ * @param row_algorithm The algorithm along the rows (GRID_RING or GRID_TREE)
+ * @param col_algorithm The algorithm along the columns (GRID_RING or GRID_TREE)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_torus_allreduce (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_double threshold,
+                       const gaspi_number_t rows,
+                       const GridAlgorithm row_algorithm,
+                       const GridAlgorithm col_algorithm,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_array, (void*) src_array, num_elem * type_size);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // the steps of the reduce-scatter and allgather phases along both dimensions
+    std::vector<grid_step> steps;
+    gaspi_number_t const tmp_elem = grid_allreduce_steps(iProc, nProc, num_elem, rows
+                                                        , row_algorithm, col_algorithm, steps);
+    const int num_steps = steps.size();
+
+    // The notification s of the window signals that the peer is ready to receive
+    // step s and the notification num_steps+s that the data of step s has been
+    // written, to the workspace in the reduce-scatter steps and to the result otherwise
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, tmp_elem * type_size, timeout, &tmp_segment, &tmp_arr) );
+    T *tmp_array = (T *) tmp_arr;
+    gaspi_notification_id_t tmp_window, window;
+    SUCCESS_OR_RETURN( notification_window(comm, tmp_segment, 2 * num_steps, &tmp_window) );
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, 2 * num_steps, &window) );
+
+    // waive to all peers that they can send
+    for (int s = 0; s < num_steps; s++) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , steps[s].recv_from, tmp_window + s, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+
+    for (int s = 0; s < num_steps; s++) {
+        grid_step const & step = steps[s];
+
+        // the reduce-scatter steps write to the workspace, the allgather steps to the result
+        gaspi_segment_id_t const segment_remote = step.reduce ? tmp_segment : buffer_receive.segment;
+        gaspi_offset_t const offset_remote = step.reduce ? step.send_tmp * type_size
+                                                         : buffer_receive.offset + step.send_start * type_size;
+        gaspi_notification_id_t const data = (step.reduce ? tmp_window : window) + num_steps + s;
+
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, tmp_window + s, step.send_to + 1, timeout ) );
+
+        if (step.send_cnt > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                    , buffer_receive.offset + step.send_start * type_size // offset
+                    , step.send_to, segment_remote, offset_remote
+                    , step.send_cnt * type_size, data
+                    , iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
+                    , queue_id, timeout
+            ) );
+        } else {
+            // zero sized writes are not allowed, there are less elements than processes
+            SUCCESS_OR_RETURN( notify_and_wait(comm, segment_remote
+                    , step.send_to, data
+                    , iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+
+        // wait for notification that the data has arrived
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, segment_remote, data, step.recv_from + 1, timeout ) );
+
+        // local reduce
+        if (step.reduce)
+            local_reduce<T>(op, step.recv_cnt, &tmp_array[step.recv_tmp], &rcv_array[step.recv_start]);
+    }
+
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Plan of a persistent segmented pipeline ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_init (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_queue_id_t queue_id,
+                           collRequest & request,
+                           const collComm & comm)
+{
+    return gaspi_ring_allreduce_init<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, request, comm);
+}
+
+/** Plan of a weakly consistent persistent segmented pipeline ring implementation
+ *
+ * The notifications are the ones of gaspi_ring_allreduce with one sub-block
+ * per chunk, in a window which the request reserves until it is destroyed or
+ * planned again. The plan is computed once, every gaspi_request_start runs
+ * the allreduce.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_ring_allreduce_init (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double threshold,
+                           const gaspi_queue_id_t queue_id,
+                           collRequest & request,
+                           const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    request_init(request, queue_id, op);
+    request.reduce = request_local_reduce<T>;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Partition elements of array into nProc chunks
+    std::vector<unsigned int> segment_sizes, segment_ends;
+    partition_chunks(num_elem, nProc, segment_sizes, segment_ends);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    request_copy(request, num_elem * type_size, src_array, rcv_array);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // Receive from left neighbor
+    const int recv_from = (iProc - 1 + nProc) % nProc;
+
+    // Send to right neighbor
+    const int send_to = (iProc + 1) % nProc;
+
+    // scatter-reduce steps followed by allgather steps
+    const int num_steps = 2 * (nProc - 1);
+
+    // the ready notification followed by the data notification of every step
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( request_window(request, comm, buffer_receive.segment, num_steps + 1, &window) );
+
+    // waive that it is ready to receive
+    request_notify(request, comm, buffer_receive.segment, recv_from, window, iProc + 1);
+
+    // wait for notification that the data can be sent
+    request_wait(request, comm, buffer_receive.segment, window, send_to + 1);
+
+    // At step t, iProc sends chunk (rank - t) and receives chunk (rank - t - 1);
+    // the first nProc - 1 steps reduce the received chunk (scatter-reduce), the
+    // remaining ones only store it (allgather)
+    for (int t = 0; t < num_steps; t++) {
+
+        int send_chunk = (iProc - t + 2 * nProc) % nProc;
+        int segment_start = segment_ends[send_chunk] - segment_sizes[send_chunk];
+        request_write(request, comm, buffer_receive.segment
+                , buffer_receive.offset + segment_start * type_size // offset
+                , send_to, buffer_receive.segment, buffer_receive.offset + segment_start * type_size // offset
+                , segment_sizes[send_chunk] * type_size, window + 1 + t
+                , iProc + 1 // notification value: +1 to avoid 0. It equals to recvfrom + 1 on receiver side
+        );
+
+        // wait for notification that the data has arrived
+        request_wait(request, comm, buffer_receive.segment, window + 1 + t, recv_from + 1);
+
+        // local reduce
+        if (t < nProc - 1) {
+            int recv_chunk = (iProc - t - 1 + 2 * nProc) % nProc;
+            segment_start = segment_ends[recv_chunk] - segment_sizes[recv_chunk];
+            request_reduce(request, segment_sizes[recv_chunk], &src_array[segment_start], &rcv_array[segment_start]);
+        }
+    }
+
+    request_flush(request);
+
+    return GASPI_SUCCESS;
+}
+
+/** Nonblocking segmented pipeline ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param request The request which is advanced by gaspi_request_test/gaspi_request_wait
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_iallreduce (const segmentBuffer buffer_send,
+                  segmentBuffer buffer_receive,
+                  const gaspi_number_t elem_cnt,
+                  const Operation & op,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm)
+{
+    return gaspi_iallreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, request, comm);
+}
+
+/** Weakly consistent nonblocking segmented pipeline ring implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param request The request which is advanced by gaspi_request_test/gaspi_request_wait
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_iallreduce (const segmentBuffer buffer_send,
+                  segmentBuffer buffer_receive,
+                  const gaspi_number_t elem_cnt,
+                  const Operation & op,
+                  const gaspi_double threshold,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm)
+{
+    SUCCESS_OR_RETURN( gaspi_ring_allreduce_init<T>(buffer_send, buffer_receive, elem_cnt, op, threshold, queue_id, request, comm) );
+
+    return gaspi_request_start(request);
+}
+
+/** Binomial tree implementation: reduce to the process 0 followed by a broadcast
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_tree_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    return gaspi_tree_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, timeout, comm);
+}
+
+/** Weakly consistent binomial tree implementation: reduce to the process 0 followed by a broadcast
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_tree_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+
+    // the reduce leaves the receive buffer alone on a single process
+    if (comm.size <= 1) {
+        gaspi_pointer_t src_arr, rcv_arr;
+        SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+        SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+        std::memcpy((char*)rcv_arr + buffer_receive.offset, (char*)src_arr + buffer_send.offset, num_elem * type_size);
+        return GASPI_SUCCESS;
+    }
+
+    SUCCESS_OR_RETURN( gaspi_reduce<T>(buffer_send, buffer_receive, elem_cnt, op, threshold, 0, queue_id, timeout, comm) );
+
+    // the offset of the broadcast is given in elements
+    segmentBuffer const buffer_result = {buffer_receive.segment, buffer_receive.offset / type_size};
+    return gaspi_bcast<T>(buffer_result, num_elem, 0, queue_id, timeout, comm);
+}
+
+/** Recursive doubling implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_recursive_doubling_allreduce (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm)
+{
+    return gaspi_recursive_doubling_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, timeout, comm);
+}
+
+/** Weakly consistent recursive doubling implementation
+ *
+ * In step i every process exchanges its partial result with the process
+ * whose id differs in bit i, so that log2(nProc) steps are needed. If nProc
+ * is not a power of two, the even processes among the first 2*(nProc - P')
+ * ones, P' being the largest power of two below nProc, hand their data to
+ * their odd neighbours beforehand and receive the result from them afterwards.
+ * The data of the peers is received in the workspace segment.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_recursive_doubling_allreduce (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+    int segment_size = num_elem * type_size;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_array, (void*) src_array, segment_size);
+
+    if ((nProc <= 1) || (num_elem == 0))
+        return GASPI_SUCCESS;
+
+    // largest power of two which is not larger than nProc
+    int pof2 = 1;
+    int num_steps = 0;
+    while (2 * pof2 <= nProc) {
+        pof2 = pof2 * 2;
+        num_steps++;
+    }
+    int rem = nProc - pof2;
+
+    // slot 0 of the workspace receives the data of the paired process,
+    // slot i+1 receives the data of step i. The notification s of the window
+    // signals that slot s is ready and the notification num_steps+1+s that it has been written
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, (num_steps + 1) * segment_size, timeout, &tmp_segment, &tmp_arr) );
+    T *tmp_array = (T *) tmp_arr;
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, tmp_segment, 2 * (num_steps + 1), &window) );
+    gaspi_notification_id_t const data = window + num_steps + 1;
+
+    // the even processes of the first 2*rem ones only hand over their data
+    if ((iProc < 2 * rem) && (iProc % 2 == 0)) {
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window, iProc + 2, timeout ) );
+
+        SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment, buffer_receive.offset
+                , iProc + 1, tmp_segment, 0
+                , segment_size, data, iProc + 1
+                , queue_id, timeout
+        ) );
+
+        // wait for the result
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data, iProc + 2, timeout ) );
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+        std::memcpy((void*) rcv_array, (void*) tmp_array, segment_size);
+
+        return GASPI_SUCCESS;
+    }
+
+    // rank among the pof2 remaining processes
+    int newrank = (iProc < 2 * rem) ? iProc / 2 : iProc - rem;
+
+    // waive to all peers that the slots are ready to receive
+    if (iProc < 2 * rem) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , iProc - 1, window, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+    for (int i = 0; i < num_steps; i++) {
+        int partner = newrank ^ (1 << i);
+        int partner_rank = (partner < rem) ? 2 * partner + 1 : partner + rem;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , partner_rank, window + i + 1, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+
+    // reduce the data of the paired process
+    if (iProc < 2 * rem) {
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data, iProc, timeout ) );
+        local_reduce<T>(op, num_elem, &tmp_array[0], &rcv_array[0]);
+    }
+
+    // exchange the partial results
+    for (int i = 0; i < num_steps; i++) {
+        int partner = newrank ^ (1 << i);
+        int partner_rank = (partner < rem) ? 2 * partner + 1 : partner + rem;
+
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + i + 1, partner_rank + 1, timeout ) );
+
+        SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment, buffer_receive.offset
+                , partner_rank, tmp_segment, (i + 1) * segment_size
+                , segment_size, data + i + 1, iProc + 1
+                , queue_id, timeout
+        ) );
+
+        // wait for notification that the data has arrived
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data + i + 1, partner_rank + 1, timeout ) );
+
+        // the partial result can be updated once it has left the buffer
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+        // local reduce
+        local_reduce<T>(op, num_elem, &tmp_array[(i + 1) * num_elem], &rcv_array[0]);
+    }
+
+    // hand the result over to the paired process
+    if (iProc < 2 * rem) {
+        SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment, buffer_receive.offset
+                , iProc - 1, tmp_segment, 0
+                , segment_size, data, iProc + 1
+                , queue_id, timeout
+        ) );
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Rabenseifner implementation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_rabenseifner_allreduce (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm)
+{
+    return gaspi_rabenseifner_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, queue_id, timeout, comm);
+}
+
+/** Weakly consistent Rabenseifner implementation
+ *
+ * The reduce-scatter is done by recursive halving: in step i every process
+ * sends the half of its current range that it does not keep to the process
+ * whose id differs in bit (log2(nProc)-1-i) and reduces the other half.
+ * The allgather is done by recursive doubling in the reverse order, so
+ * that only 2*log2(nProc) steps are needed while every process still sends
+ * about 2*elem_cnt elements. If nProc is not a power of two, the even
+ * processes among the first 2*(nProc - P') ones, P' being the largest power
+ * of two below nProc, hand their data to their odd neighbours beforehand and
+ * receive the result from them afterwards. The data of the reduce-scatter
+ * is received in the workspace segment.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_rabenseifner_allreduce (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // only the first ceil(elem_cnt * threshold) elements are reduced
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    // type size
+    int type_size = sizeof(T);
+    int segment_size = num_elem * type_size;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_array, (void*) src_array, segment_size);
+
+    if ((nProc <= 1) || (num_elem == 0))
+        return GASPI_SUCCESS;
+
+    // largest power of two which is not larger than nProc
+    int pof2 = 1;
+    int num_steps = 0;
+    while (2 * pof2 <= nProc) {
+        pof2 = pof2 * 2;
+        num_steps++;
+    }
+    int rem = nProc - pof2;
+
+    // slot 0 of the workspace receives the data of the paired process, the
+    // following num_elem elements the halves of the reduce-scatter. The
+    // notification 0 of the window signals that slot 0 is ready and the notification i+1
+    // that the half of step i can be written, the notification num_steps+1
+    // that slot 0 has been written and num_steps+2+i that the half of step i has.
+    // The allgather steps notify in a window on the receive segment
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, 2 * segment_size, timeout, &tmp_segment, &tmp_arr) );
+    T *tmp_array = (T *) tmp_arr;
+    gaspi_notification_id_t window, window_receive;
+    SUCCESS_OR_RETURN( notification_window(comm, tmp_segment, 2 * (num_steps + 1), &window) );
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, num_steps, &window_receive) );
+    gaspi_notification_id_t const data = window + num_steps + 1;
+
+    // the even processes of the first 2*rem ones only hand over their data
+    if ((iProc < 2 * rem) && (iProc % 2 == 0)) {
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window, iProc + 2, timeout ) );
+
+        SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment, buffer_receive.offset
+                , iProc + 1, tmp_segment, 0
+                , segment_size, data, iProc + 1
+                , queue_id, timeout
+        ) );
+
+        // wait for the result
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data, iProc + 2, timeout ) );
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+        std::memcpy((void*) rcv_array, (void*) tmp_array, segment_size);
+
+        return GASPI_SUCCESS;
+    }
+
+    // rank among the pof2 remaining processes
+    int newrank = (iProc < 2 * rem) ? iProc / 2 : iProc - rem;
+
+    // Partition elements of array into pof2 chunks
+    std::vector<unsigned int> segment_sizes, segment_ends;
+    partition_chunks(num_elem, pof2, segment_sizes, segment_ends);
+
+    // waive to all peers that the slots are ready to receive
+    if (iProc < 2 * rem) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , iProc - 1, window, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+    for (int i = 0, mask = pof2 / 2; mask > 0; i++, mask = mask / 2) {
+        int partner = newrank ^ mask;
+        int partner_rank = (partner < rem) ? 2 * partner + 1 : partner + rem;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                , partner_rank, window + i + 1, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+
+    // reduce the data of the paired process
+    if (iProc < 2 * rem) {
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data, iProc, timeout ) );
+        local_reduce<T>(op, num_elem, &tmp_array[0], &rcv_array[0]);
+    }
+
+    // reduce-scatter phase (recursive halving)
+    // the process keeps the chunks [lo, hi), at the end only the chunk newrank
+    int lo = 0, hi = pof2;
+    // the halves of the consecutive steps are stored one after the other
+    int slot_start = num_elem;
+    for (int i = 0, mask = pof2 / 2; mask > 0; i++, mask = mask / 2) {
+        int partner = newrank ^ mask;
+        int partner_rank = (partner < rem) ? 2 * partner + 1 : partner + rem;
+
+        int mid = lo + mask;
+        int send_lo = (newrank & mask) ? lo : mid;
+        int keep_lo = (newrank & mask) ? mid : lo;
+        int send_start = segment_ends[send_lo] - segment_sizes[send_lo];
+        int send_cnt = segment_ends[send_lo + mask - 1] - send_start;
+        int keep_start = segment_ends[keep_lo] - segment_sizes[keep_lo];
+        int keep_cnt = segment_ends[keep_lo + mask - 1] - keep_start;
+
+        // wait for notification that the data can be sent
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + i + 1, partner_rank + 1, timeout ) );
+
+        // write the half the partner keeps, which has the same position in its workspace
+        if (send_cnt > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                    , buffer_receive.offset + send_start * type_size
+                    , partner_rank, tmp_segment, slot_start * type_size
+                    , send_cnt * type_size, data + i + 1, iProc + 1
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                    , partner_rank, data + i + 1, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+
+        // wait for notification that the data has arrived
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, data + i + 1, partner_rank + 1, timeout ) );
+
+        // the half which has been sent must not be modified before it has left the buffer
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+        // local reduce
+        local_reduce<T>(op, keep_cnt, &tmp_array[slot_start], &rcv_array[keep_start]);
+
+        slot_start += keep_cnt;
+        lo = keep_lo;
+        hi = keep_lo + mask;
+    }
+
+    // allgather phase (recursive doubling)
+    // the data is written directly to the receive buffer of the partner
+    for (int i = 0, mask = 1; mask < pof2; i++, mask = mask * 2) {
+        int partner = newrank ^ mask;
+        int partner_rank = (partner < rem) ? 2 * partner + 1 : partner + rem;
+
+        int send_start = segment_ends[lo] - segment_sizes[lo];
+        int send_cnt = segment_ends[hi - 1] - send_start;
+
+        gaspi_notification_id_t data_available = window_receive + i;
+        if (send_cnt > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment
+                    , buffer_receive.offset + send_start * type_size
+                    , partner_rank, buffer_receive.segment
+                    , buffer_receive.offset + send_start * type_size
+                    , send_cnt * type_size, data_available, iProc + 1
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_receive.segment
+                    , partner_rank, data_available, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+
+        // wait for notification that the data has arrived
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, data_available, partner_rank + 1, timeout ) );
+
+        lo = MIN(lo, lo ^ mask);
+        hi = lo + 2 * mask;
+    }
+
+    // hand the result over to the paired process
+    if (iProc < 2 * rem) {
+        SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_receive.segment, buffer_receive.offset
+                , iProc - 1, tmp_segment, 0
+                , segment_size, data, iProc + 1
+                , queue_id, timeout
+        ) );
+    }
+
+    // the buffer can be modified once the data has left it
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Time-budget allreduce that reduces the data chunk by chunk with the ring
+ *
+ * Every process votes whether it still has time before a chunk is started,
+ * and the GASPI allreduce of the votes with the minimum makes all processes
+ * take the same decision.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param chunk_elem_cnt The number of data elements per chunk
+ * @param budget Time in milliseconds after which no further chunk is started (or GASPI_BLOCK for all chunks)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param completed The number of leading elements which have been reduced
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_allreduce_budget (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_number_t chunk_elem_cnt,
+                        const gaspi_timeout_t budget,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout,
+                        gaspi_number_t & completed,
+                        const collComm & comm)
+{
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+
+    // type size
+    int type_size = sizeof(T);
+
+    gaspi_number_t const chunk_size = MAX(chunk_elem_cnt, 1);
+    gaspi_number_t const num_chunks = (elem_cnt + chunk_size - 1) / chunk_size;
+
+    completed = 0;
+    for (gaspi_number_t k = 0; k < num_chunks; k++) {
+        gaspi_timeout_t const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                                            (std::chrono::steady_clock::now() - start).count();
+        int vote = (budget == GASPI_BLOCK) || (elapsed < budget);
+        int decision;
+        SUCCESS_OR_RETURN( gaspi_allreduce(&vote, &decision, 1, GASPI_OP_MIN, GASPI_TYPE_INT
+                                          , comm.group, timeout) );
+        if (!decision)
+            break;
+
+        gaspi_number_t const chunk_start = k * chunk_size;
+        gaspi_number_t const chunk_cnt = MIN(chunk_size, elem_cnt - chunk_start);
+        segmentBuffer const chunk_send = {buffer_send.segment, buffer_send.offset + chunk_start * type_size};
+        segmentBuffer const chunk_receive = {buffer_receive.segment, buffer_receive.offset + chunk_start * type_size};
+
+        SUCCESS_OR_RETURN( gaspi_ring_allreduce<T>(chunk_send, chunk_receive, chunk_cnt, op, queue_id, timeout, comm) );
+        completed = chunk_start + chunk_cnt;
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Sparse allreduce of the k elements with the largest magnitude
+ *
+ * Every process sends the indices and the values of its k largest elements
+ * instead of the data. A list takes a slot of the workspace segment with the
+ * k indices followed by the k values, both rounded up to 8 bytes.
+ *
+ * SPARSE_ALLGATHER: every process writes its list into slot iProc of all
+ * peers once they have notified (notification 2*nProc+iProc) that the slot
+ * is free, with notification nProc+iProc. The lists are reduced in the order
+ * of the ranks, so the result is the same on all processes.
+ *
+ * SPARSE_TREE: the lists are merged up the binomial tree rooted at 0. A
+ * process merges the list of the child at level i (slot and notification i)
+ * into its own one (slot upper_bound), keeps the k largest elements of the
+ * merged list and sends them to its parent once the parent is ready
+ * (notification upper_bound). The list of the root is written down the tree
+ * into slot upper_bound with notification upper_bound+1. The notifications
+ * are counted from the start of a window of the workspace segment.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param k The number of elements which every process selects
+ * @param algorithm The exchange of the selected elements (SPARSE_ALLGATHER or SPARSE_TREE)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ * @param residual The residual of the error feedback or NULL, the selected
+ * elements of the process are cleared and the elements which a merge of the
+ * tree drops are added to it, so the result and the residuals of all
+ * processes sum up to the data
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> static gaspi_return_t 
+topk_allreduce (const segmentBuffer buffer_send,
+                segmentBuffer buffer_receive,
+                const gaspi_number_t elem_cnt,
+                const Operation & op,
+                const gaspi_number_t k,
+                const SparseAlgorithm algorithm,
+                const gaspi_queue_id_t queue_id,
+                const gaspi_timeout_t timeout,
+                const collComm & comm,
+                T *residual)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *rcv_array = (T *)((char*)rcv_arr + buffer_receive.offset);
+
+    gaspi_number_t const num = MIN(k, elem_cnt);
+
+    // slot of a list in the workspace
+    gaspi_size_t const idx_size = ((num * sizeof(unsigned int) + 7) / 8) * 8;
+    gaspi_size_t const slot_size = idx_size + ((num * type_size + 7) / 8) * 8;
+
+    int upper_bound = ceil(log2(nProc));
+    gaspi_number_t const num_slots = (algorithm == SPARSE_TREE) ? upper_bound + 1 : nProc;
+
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, num_slots * slot_size, timeout, &tmp_segment, &tmp_arr) );
+    auto slot_idx = [&](gaspi_number_t slot) {
+        return (unsigned int *)((char*)tmp_arr + slot * slot_size);
+    };
+    auto slot_val = [&](gaspi_number_t slot) {
+        return (T *)((char*)tmp_arr + slot * slot_size + idx_size);
+    };
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, tmp_segment
+                                          , (algorithm == SPARSE_TREE) ? upper_bound + 2 : 3 * nProc, &window) );
+
+    // select the local elements into the slot of the own list
+    gaspi_number_t const own = (algorithm == SPARSE_TREE) ? upper_bound : iProc;
+    std::vector<unsigned int> indices;
+    sparse_select<T>(src_array, elem_cnt, num, indices);
+    for (gaspi_number_t j = 0; j < num; j++) {
+        slot_idx(own)[j] = indices[j];
+        slot_val(own)[j] = src_array[indices[j]];
+    }
+
+    // the selected elements are sent, the residual may alias the data
+    if (residual != NULL) {
+        for (unsigned int idx : indices)
+            residual[idx] = 0;
+    }
+
+    if ((nProc > 1) && (num > 0) && (algorithm == SPARSE_ALLGATHER)) {
+        // waive to all peers that their slots are ready to receive
+        for (gaspi_rank_t p = 0; p < nProc; p++) {
+            if (p != iProc) {
+                SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                        , p, window + 2 * nProc + iProc, iProc + 1
+                        , queue_id, timeout
+                ) );
+            }
+        }
+
+        // send the list to the peers, starting with the next one
+        for (gaspi_rank_t i = 1; i < nProc; i++) {
+            gaspi_rank_t const p = (iProc + i) % nProc;
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + 2 * nProc + p, p + 1, timeout ) );
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, tmp_segment, iProc * slot_size
+                    , p, tmp_segment, iProc * slot_size
+                    , slot_size, window + nProc + iProc, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+    } else if ((nProc > 1) && (num > 0)) {
+        // compute parent by flipping the leftmost 1-bit of the process id
+        int j = 1;
+        while (j <= iProc)
+            j = j * 2;
+        int parent = iProc - j / 2;
+
+        // the level of the process in the subtree of its parent
+        int level = 0;
+        while ((2 << level) <= iProc)
+            level++;
+
+        // notify the children that their slots are ready, the ones with the
+        // smallest subtrees are merged first
+        std::vector<int> levels;
+        for (int pow2i = j, i = (iProc == 0) ? 0 : level + 1; iProc + pow2i < nProc; pow2i = pow2i * 2, i++) {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, tmp_segment
+                    , iProc + pow2i, window + upper_bound, iProc + 1
+                    , queue_id, timeout
+            ) );
+            levels.push_back(i);
+        }
+
+        std::vector<unsigned int> merged_idx, top;
+        std::vector<T> merged_val;
+        for (int i : levels) {
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + i, iProc + (1 << i) + 1, timeout ) );
+
+            sparse_merge<T>(op, slot_idx(upper_bound), slot_val(upper_bound), num
+                           , slot_idx(i), slot_val(i), num
+                           , merged_idx, merged_val);
+
+            // keep the k largest elements of the merged list
+            sparse_select<T>(merged_val.data(), merged_val.size(), num, top);
+            for (gaspi_number_t e = 0; e < num; e++) {
+                slot_idx(upper_bound)[e] = merged_idx[top[e]];
+                slot_val(upper_bound)[e] = merged_val[top[e]];
+            }
+
+            // the dropped elements of the merged list are kept in the residual,
+            // they may stem from other processes
+            if (residual != NULL) {
+                for (gaspi_number_t m = 0, e = 0; m < merged_idx.size(); m++) {
+                    if ((e < num) && (top[e] == m))
+                        e++;
+                    else
+                        residual[merged_idx[m]] += merged_val[m];
+                }
+            }
+        }
+
+        if (iProc != 0) {
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + upper_bound, parent + 1, timeout ) );
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, tmp_segment, upper_bound * slot_size
+                    , parent, tmp_segment, level * slot_size
+                    , slot_size, window + level, iProc + 1
+                    , queue_id, timeout
+            ) );
+
+            // receive the list of the root
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + upper_bound + 1, parent + 1, timeout ) );
+        }
+
+        // forward the list of the root to the children
+        for (int pow2i = j; iProc + pow2i < nProc; pow2i = pow2i * 2) {
+            SUCCESS_OR_RETURN( write_notify_and_wait(comm, tmp_segment, upper_bound * slot_size
+                    , iProc + pow2i, tmp_segment, upper_bound * slot_size
+                    , slot_size, window + upper_bound + 1, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+    }
+
+    // the elements which are not in any list are zero
+    std::memset((void*) rcv_array, 0, elem_cnt * type_size);
+    std::vector<bool> selected(elem_cnt, false);
+
+    gaspi_number_t const first = (algorithm == SPARSE_TREE) ? upper_bound : 0;
+    gaspi_number_t const last = ((algorithm == SPARSE_TREE) || (nProc <= 1)) ? first : nProc - 1;
+    for (gaspi_number_t slot = first; slot <= last; slot++) {
+        if ((slot != own) && (num > 0))
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, tmp_segment, window + nProc + slot, slot + 1, timeout ) );
+
+        unsigned int const *idx = slot_idx(slot);
+        T const *val = slot_val(slot);
+        for (gaspi_number_t e = 0; e < num; e++) {
+            if (selected[idx[e]])
+                local_reduce<T>(op, 1, &val[e], &rcv_array[idx[e]]);
+            else {
+                rcv_array[idx[e]] = val[e];
+                selected[idx[e]] = true;
+            }
+        }
+    }
+
+    // the own list must not be overwritten before it has been sent
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Sparse allreduce of the k elements with the largest magnitude
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param k The number of elements which every process selects
+ * @param algorithm The exchange of the selected elements (SPARSE_ALLGATHER or SPARSE_TREE)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_topk_allreduce (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t k,
+                      const SparseAlgorithm algorithm,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    return topk_allreduce<T>(buffer_send, buffer_receive, elem_cnt, op, k, algorithm, queue_id, timeout, comm, (T *) NULL);
+}
+
+/** Sparse allreduce of the k elements with the largest magnitude with error feedback
+ *
+ * The data is added to the residual, and the k elements with the largest
+ * magnitude of the residual are summed up with gaspi_topk_allreduce. The
+ * selected elements of the residual are cleared, the others are kept for the
+ * next call. An element which a merge of SPARSE_TREE drops is added to the
+ * residual of the merging process, so the result and the residuals of all
+ * processes always sum up to the data of all calls.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_residual Segment with offset of the residual (elem_cnt elements)
+ * @param elem_cnt Number of data elements in the buffer
+ * @param k The number of elements which every process selects
+ * @param algorithm The exchange of the selected elements (SPARSE_ALLGATHER or SPARSE_TREE)
+ * @param queue_id Queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+template <typename T> gaspi_return_t 
+gaspi_topk_allreduce_feedback (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               segmentBuffer buffer_residual,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_number_t k,
+                               const SparseAlgorithm algorithm,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm)
+{
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, res_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_residual.segment, &res_arr) );
+    T *src_array = (T *)((char*)src_arr + buffer_send.offset);
+    T *res_array = (T *)((char*)res_arr + buffer_residual.offset);
+
+    local_reduce<T>(SUM, elem_cnt, src_array, res_array);
+
+    return topk_allreduce<T>(buffer_residual, buffer_receive, elem_cnt, SUM, k, algorithm, queue_id, timeout, comm, res_array);
+}
+
+/** Plan of a bounded-staleness allreduce
+ *
+ * The allreduce keeps staleness + 1 buffers, each with a stage for the data
+ * and a result of elem_cnt elements in buffer_tmp. Every buffer gets a
+ * persistent ring allreduce (gaspi_ring_allreduce_init), which reserves its
+ * own window of notification ids, so the rings of all buffers can be in
+ * progress at the same time. The notification values
+ * of a ring are the rank values of gaspi_ring_allreduce, to which
+ * gaspi_stale_allreduce adds the version of the buffer.
+ *
+ * @param buffer_send Segment with offset of the data, which is read by every gaspi_stale_allreduce
+ * @param buffer_tmp Segment with offset of the buffers (2 * (staleness + 1) * elem_cnt elements)
+ * @param elem_cnt Number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM).
+ * @param staleness The largest number of iterations by which a result may be older than the data
+ * @param queue_id Queue id
+ * @param stale The state of the allreduce
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error
+ */
+template <typename T> gaspi_return_t 
+gaspi_stale_allreduce_init (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_tmp,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_number_t staleness,
+                            const gaspi_queue_id_t queue_id,
+                            collStale & stale,
+                            const collComm & comm)
+{
+    gaspi_rank_t const nProc = comm.size;
+
+    gaspi_number_t const num_buffers = staleness + 1;
+
+    // type size
+    int type_size = sizeof(T);
+    gaspi_size_t const segment_size = elem_cnt * type_size;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_arr, tmp_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_arr) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_tmp.segment, &tmp_arr) );
+
+    stale.requests = std::vector<collRequest>(num_buffers);
+    stale.versions.assign(num_buffers, 0);
+    stale.running.assign(num_buffers, false);
+    stale.completed.assign(num_buffers, false);
+    stale.iteration = 0;
+    stale.staleness = staleness;
+    stale.num_ranks = nProc;
+    stale.size = segment_size;
+    stale.src = (const char *) src_arr + buffer_send.offset;
+    stale.tmp = (char *) tmp_arr + buffer_tmp.offset;
+
+    // buffer b stages the data at 2*b*segment_size and reduces it behind,
+    // every ring reserves its own window of notification ids
+    for (gaspi_number_t b = 0; b < num_buffers; b++) {
+        segmentBuffer const stage = {buffer_tmp.segment, buffer_tmp.offset + 2 * b * segment_size};
+        segmentBuffer const result = {buffer_tmp.segment, buffer_tmp.offset + (2 * b + 1) * segment_size};
+        SUCCESS_OR_RETURN( gaspi_ring_allreduce_init<T>(stage, result, elem_cnt, op, queue_id, stale.requests[b], comm) );
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Bounded-staleness allreduce
+ *
+ * The data of the call is staged into the buffer of the iteration, whose
+ * ring is started once the ring of the iteration staleness + 1 calls ago has
+ * completed. The rings which are in progress are advanced without blocking,
+ * and the result of the latest iteration whose ring has completed is
+ * returned. Only if the result of no iteration within the staleness has
+ * completed, the call waits for the oldest ring which is in progress.
+ *
+ * @param stale The state of the allreduce
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param version The iteration of the reduced data
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+gaspi_return_t 
+gaspi_stale_allreduce (collStale & stale,
+                       segmentBuffer buffer_receive,
+                       gaspi_number_t & version,
+                       const gaspi_timeout_t timeout)
+{
+    gaspi_number_t const num_buffers = stale.requests.size();
+    if (num_buffers == 0)
+        return GASPI_ERROR;
+
+    // advance the rings which are in progress
+    auto progress = [&stale, num_buffers]() -> gaspi_return_t {
+        for (gaspi_number_t b = 0; b < num_buffers; b++) {
+            if (!stale.running[b])
+                continue;
+
+            gaspi_return_t const ret = gaspi_request_test(stale.requests[b]);
+            if (ret == GASPI_SUCCESS) {
+                stale.running[b] = false;
+                stale.completed[b] = true;
+            } else if (ret != GASPI_TIMEOUT)
+                return ret;
+        }
+        return GASPI_SUCCESS;
+    };
+
+    SUCCESS_OR_RETURN( progress() );
+
+    // start the ring of the iteration, its buffer has to be free
+    gaspi_number_t const iteration = stale.iteration;
+    gaspi_number_t const b = iteration % num_buffers;
+    if (stale.running[b]) {
+        SUCCESS_OR_RETURN( gaspi_request_wait(stale.requests[b], timeout) );
+        stale.running[b] = false;
+    }
+
+    // the notification values of the ring carry the version of the buffer,
+    // i.e. the number of times it has been used, next to the rank, so a
+    // notification of another iteration is an error instead of being taken
+    // for the data of this one
+    gaspi_rank_t const nProc = stale.num_ranks;
+    gaspi_notification_t const cycle = std::numeric_limits<gaspi_notification_t>::max() / nProc - 1;
+    gaspi_notification_t const buffer_version = (iteration / num_buffers) % cycle;
+    for (requestAction & action : stale.requests[b].actions) {
+        if (action.notification_value != 0)
+            action.notification_value = (action.notification_value - 1) % nProc + 1 + buffer_version * nProc;
+    }
+
+    std::memcpy((void*) (stale.tmp + 2 * b * stale.size), (void*) stale.src, stale.size);
+    SUCCESS_OR_RETURN( gaspi_request_start(stale.requests[b]) );
+    stale.versions[b] = iteration;
+    stale.running[b] = true;
+    stale.completed[b] = false;
+    stale.iteration++;
+
+    SUCCESS_OR_RETURN( progress() );
+
+    // the latest completed result within the staleness, otherwise wait for
+    // the oldest ring, all rings in progress are within the staleness
+    int latest = -1;
+    while (latest < 0) {
+        int oldest = -1;
+        for (gaspi_number_t i = 0; i < num_buffers; i++) {
+            if (stale.completed[i] && (stale.versions[i] + stale.staleness >= iteration)
+                && ((latest < 0) || (stale.versions[i] > stale.versions[latest])))
+                latest = i;
+            if (stale.running[i] && ((oldest < 0) || (stale.versions[i] < stale.versions[oldest])))
+                oldest = i;
+        }
+
+        if ((latest < 0) && (oldest >= 0)) {
+            SUCCESS_OR_RETURN( gaspi_request_wait(stale.requests[oldest], timeout) );
+            stale.running[oldest] = false;
+            stale.completed[oldest] = true;
+            SUCCESS_OR_RETURN( progress() );
+        }
+    }
+
+    gaspi_pointer_t rcv_arr;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_arr) );
+    std::memcpy((char*)rcv_arr + buffer_receive.offset, (void*) (stale.tmp + (2 * latest + 1) * stale.size), stale.size);
+    version = stale.versions[latest];
+
+    return GASPI_SUCCESS;
+}
+
+/** Complete the rings of a bounded-staleness allreduce which are in progress
+ *
+ * It has to be called before the buffers are released.
+ *
+ * @param stale The state of the allreduce
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout
+ */
+gaspi_return_t 
+gaspi_stale_allreduce_wait (collStale & stale,
+                            const gaspi_timeout_t timeout)
+{
+    for (gaspi_number_t b = 0; b < stale.requests.size(); b++) {
+        if (stale.running[b]) {
+            SUCCESS_OR_RETURN( gaspi_request_wait(stale.requests[b], timeout) );
+            stale.running[b] = false;
+            stale.completed[b] = true;
+        }
+    }
+
+    return GASPI_SUCCESS;
+}
+
+// explicit template instantiation
+template gaspi_return_t 
+gaspi_ring_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<double> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<float> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<int> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<unsigned int> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<double> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<float> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<double> (const segmentBuffer buffer_send,
+                                      segmentBuffer buffer_receive,
+                                      const gaspi_number_t elem_cnt,
+                                      const Operation & op,
+                                      const gaspi_queue_id_t queue_id,
+                                      const gaspi_timeout_t timeout,
+                                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<float> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<int> (const segmentBuffer buffer_send,
+                                   segmentBuffer buffer_receive,
+                                   const gaspi_number_t elem_cnt,
+                                   const Operation & op,
+                                   const gaspi_queue_id_t queue_id,
+                                   const gaspi_timeout_t timeout,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                            segmentBuffer buffer_receive,
+                                            const gaspi_number_t elem_cnt,
+                                            const Operation & op,
+                                            const gaspi_queue_id_t queue_id,
+                                            const gaspi_timeout_t timeout,
+                                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<double> (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_number_t rows,
+                               const GridAlgorithm row_algorithm,
+                               const GridAlgorithm col_algorithm,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_number_t rows,
+                              const GridAlgorithm row_algorithm,
+                              const GridAlgorithm col_algorithm,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<int> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_number_t rows,
+                            const GridAlgorithm row_algorithm,
+                            const GridAlgorithm col_algorithm,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_number_t rows,
+                                     const GridAlgorithm row_algorithm,
+                                     const GridAlgorithm col_algorithm,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<double> (const segmentBuffer buffer_send,
+                                   segmentBuffer buffer_receive,
+                                   const gaspi_number_t elem_cnt,
+                                   const Operation & op,
+                                   const gaspi_queue_id_t queue_id,
+                                   collRequest & request,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<float> (const segmentBuffer buffer_send,
+                                  segmentBuffer buffer_receive,
+                                  const gaspi_number_t elem_cnt,
+                                  const Operation & op,
+                                  const gaspi_queue_id_t queue_id,
+                                  collRequest & request,
+                                  const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<int> (const segmentBuffer buffer_send,
+                                segmentBuffer buffer_receive,
+                                const gaspi_number_t elem_cnt,
+                                const Operation & op,
+                                const gaspi_queue_id_t queue_id,
+                                collRequest & request,
+                                const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<unsigned int> (const segmentBuffer buffer_send,
+                                         segmentBuffer buffer_receive,
+                                         const gaspi_number_t elem_cnt,
+                                         const Operation & op,
+                                         const gaspi_queue_id_t queue_id,
+                                         collRequest & request,
+                                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<double> (const segmentBuffer buffer_send,
+                          segmentBuffer buffer_receive,
+                          const gaspi_number_t elem_cnt,
+                          const Operation & op,
+                          const gaspi_queue_id_t queue_id,
+                          collRequest & request,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<float> (const segmentBuffer buffer_send,
+                         segmentBuffer buffer_receive,
+                         const gaspi_number_t elem_cnt,
+                         const Operation & op,
+                         const gaspi_queue_id_t queue_id,
+                         collRequest & request,
+                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<int> (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_queue_id_t queue_id,
+                       collRequest & request,
+                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<unsigned int> (const segmentBuffer buffer_send,
+                                segmentBuffer buffer_receive,
+                                const gaspi_number_t elem_cnt,
+                                const Operation & op,
+                                const gaspi_queue_id_t queue_id,
+                                collRequest & request,
+                                const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<double> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<float> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<int> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+// weakly consistent allreduce
+
+template gaspi_return_t 
+gaspi_ring_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_number_t subblock_elem_cnt,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_number_t subblock_elem_cnt,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_number_t subblock_elem_cnt,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_number_t subblock_elem_cnt,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<double> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_double threshold,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<float> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_double threshold,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<int> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_double threshold,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_buffered<unsigned int> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       const gaspi_number_t elem_cnt,
+                                       const Operation & op,
+                                       const gaspi_double threshold,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<double> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<float> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_multi_ring_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_number_t num_rings,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<double> (const segmentBuffer buffer_send,
+                                      segmentBuffer buffer_receive,
+                                      const gaspi_number_t elem_cnt,
+                                      const Operation & op,
+                                      const gaspi_double threshold,
+                                      const gaspi_queue_id_t queue_id,
+                                      const gaspi_timeout_t timeout,
+                                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<float> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_double threshold,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<int> (const segmentBuffer buffer_send,
+                                   segmentBuffer buffer_receive,
+                                   const gaspi_number_t elem_cnt,
+                                   const Operation & op,
+                                   const gaspi_double threshold,
+                                   const gaspi_queue_id_t queue_id,
+                                   const gaspi_timeout_t timeout,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_hierarchical_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                            segmentBuffer buffer_receive,
+                                            const gaspi_number_t elem_cnt,
+                                            const Operation & op,
+                                            const gaspi_double threshold,
+                                            const gaspi_queue_id_t queue_id,
+                                            const gaspi_timeout_t timeout,
+                                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<double> (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_double threshold,
+                               const gaspi_number_t rows,
+                               const GridAlgorithm row_algorithm,
+                               const GridAlgorithm col_algorithm,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_number_t rows,
+                              const GridAlgorithm row_algorithm,
+                              const GridAlgorithm col_algorithm,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<int> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double threshold,
+                            const gaspi_number_t rows,
+                            const GridAlgorithm row_algorithm,
+                            const GridAlgorithm col_algorithm,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_torus_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_double threshold,
+                                     const gaspi_number_t rows,
+                                     const GridAlgorithm row_algorithm,
+                                     const GridAlgorithm col_algorithm,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<double> (const segmentBuffer buffer_send,
+                                   segmentBuffer buffer_receive,
+                                   const gaspi_number_t elem_cnt,
+                                   const Operation & op,
+                                   const gaspi_double threshold,
+                                   const gaspi_queue_id_t queue_id,
+                                   collRequest & request,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<float> (const segmentBuffer buffer_send,
+                                  segmentBuffer buffer_receive,
+                                  const gaspi_number_t elem_cnt,
+                                  const Operation & op,
+                                  const gaspi_double threshold,
+                                  const gaspi_queue_id_t queue_id,
+                                  collRequest & request,
+                                  const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<int> (const segmentBuffer buffer_send,
+                                segmentBuffer buffer_receive,
+                                const gaspi_number_t elem_cnt,
+                                const Operation & op,
+                                const gaspi_double threshold,
+                                const gaspi_queue_id_t queue_id,
+                                collRequest & request,
+                                const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ring_allreduce_init<unsigned int> (const segmentBuffer buffer_send,
+                                         segmentBuffer buffer_receive,
+                                         const gaspi_number_t elem_cnt,
+                                         const Operation & op,
+                                         const gaspi_double threshold,
+                                         const gaspi_queue_id_t queue_id,
+                                         collRequest & request,
+                                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<double> (const segmentBuffer buffer_send,
+                          segmentBuffer buffer_receive,
+                          const gaspi_number_t elem_cnt,
+                          const Operation & op,
+                          const gaspi_double threshold,
+                          const gaspi_queue_id_t queue_id,
+                          collRequest & request,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<float> (const segmentBuffer buffer_send,
+                         segmentBuffer buffer_receive,
+                         const gaspi_number_t elem_cnt,
+                         const Operation & op,
+                         const gaspi_double threshold,
+                         const gaspi_queue_id_t queue_id,
+                         collRequest & request,
+                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<int> (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_double threshold,
+                       const gaspi_queue_id_t queue_id,
+                       collRequest & request,
+                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_iallreduce<unsigned int> (const segmentBuffer buffer_send,
+                                segmentBuffer buffer_receive,
+                                const gaspi_number_t elem_cnt,
+                                const Operation & op,
+                                const gaspi_double threshold,
+                                const gaspi_queue_id_t queue_id,
+                                collRequest & request,
+                                const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<double> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_double threshold,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<float> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_double threshold,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<int> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_double threshold,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_recursive_doubling_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_receive,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_double threshold,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_rabenseifner_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+// time-budget allreduce
+template gaspi_return_t 
+gaspi_allreduce_budget<double> (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_number_t chunk_elem_cnt,
+                               const gaspi_timeout_t budget,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               gaspi_number_t & completed,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_budget<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_number_t chunk_elem_cnt,
+                              const gaspi_timeout_t budget,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              gaspi_number_t & completed,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_budget<int> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_number_t chunk_elem_cnt,
+                            const gaspi_timeout_t budget,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            gaspi_number_t & completed,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_budget<unsigned int> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_number_t chunk_elem_cnt,
+                                     const gaspi_timeout_t budget,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     gaspi_number_t & completed,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_number_t k,
+                              const SparseAlgorithm algorithm,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce<float> (const segmentBuffer buffer_send,
+                             segmentBuffer buffer_receive,
+                             const gaspi_number_t elem_cnt,
+                             const Operation & op,
+                             const gaspi_number_t k,
+                             const SparseAlgorithm algorithm,
+                             const gaspi_queue_id_t queue_id,
+                             const gaspi_timeout_t timeout,
+                             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce<int> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_number_t k,
+                           const SparseAlgorithm algorithm,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t k,
+                                    const SparseAlgorithm algorithm,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce_feedback<double> (const segmentBuffer buffer_send,
+                                       segmentBuffer buffer_receive,
+                                       segmentBuffer buffer_residual,
+                                       const gaspi_number_t elem_cnt,
+                                       const gaspi_number_t k,
+                                       const SparseAlgorithm algorithm,
+                                       const gaspi_queue_id_t queue_id,
+                                       const gaspi_timeout_t timeout,
+                                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce_feedback<float> (const segmentBuffer buffer_send,
+                                      segmentBuffer buffer_receive,
+                                      segmentBuffer buffer_residual,
+                                      const gaspi_number_t elem_cnt,
+                                      const gaspi_number_t k,
+                                      const SparseAlgorithm algorithm,
+                                      const gaspi_queue_id_t queue_id,
+                                      const gaspi_timeout_t timeout,
+                                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce_feedback<int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    segmentBuffer buffer_residual,
+                                    const gaspi_number_t elem_cnt,
+                                    const gaspi_number_t k,
+                                    const SparseAlgorithm algorithm,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_topk_allreduce_feedback<unsigned int> (const segmentBuffer buffer_send,
+                                             segmentBuffer buffer_receive,
+                                             segmentBuffer buffer_residual,
+                                             const gaspi_number_t elem_cnt,
+                                             const gaspi_number_t k,
+                                             const SparseAlgorithm algorithm,
+                                             const gaspi_queue_id_t queue_id,
+                                             const gaspi_timeout_t timeout,
+                                             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_stale_allreduce_init<double> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_tmp,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t staleness,
+                                    const gaspi_queue_id_t queue_id,
+                                    collStale & stale,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_stale_allreduce_init<float> (const segmentBuffer buffer_send,
+                                   segmentBuffer buffer_tmp,
+                                   const gaspi_number_t elem_cnt,
+                                   const Operation & op,
+                                   const gaspi_number_t staleness,
+                                   const gaspi_queue_id_t queue_id,
+                                   collStale & stale,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_stale_allreduce_init<int> (const segmentBuffer buffer_send,
+                                 segmentBuffer buffer_tmp,
+                                 const gaspi_number_t elem_cnt,
+                                 const Operation & op,
+                                 const gaspi_number_t staleness,
+                                 const gaspi_queue_id_t queue_id,
+                                 collStale & stale,
+                                 const collComm & comm);
+
+template gaspi_return_t 
+gaspi_stale_allreduce_init<unsigned int> (const segmentBuffer buffer_send,
+                                          segmentBuffer buffer_tmp,
+                                          const gaspi_number_t elem_cnt,
+                                          const Operation & op,
+                                          const gaspi_number_t staleness,
+                                          const gaspi_queue_id_t queue_id,
+                                          collStale & stale,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<float> (const segmentBuffer buffer_send,
+                             segmentBuffer buffer_receive,
+                             const gaspi_number_t elem_cnt,
+                             const Operation & op,
+                             const gaspi_queue_id_t queue_id,
+                             const gaspi_timeout_t timeout,
+                             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<int> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<float> (const segmentBuffer buffer_send,
+                             segmentBuffer buffer_receive,
+                             const gaspi_number_t elem_cnt,
+                             const Operation & op,
+                             const gaspi_double threshold,
+                             const gaspi_queue_id_t queue_id,
+                             const gaspi_timeout_t timeout,
+                             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<int> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double threshold,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_tree_allreduce<unsigned int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_double threshold,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
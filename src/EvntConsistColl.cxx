@@ -1,4 +1,5 @@
 
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <vector>
@@ -7,10 +8,16 @@
 
 #include <EvntConsistColl.hxx>
 
-#include "success_or_die.h"
+#include "success_or_return.h"
 #include "testsome.h"
 #include "queue.h"
 #include "waitsome.h"
+#include "partition.h"
+#include "communicator.h"
+#include "notification.h"
+#include "request.h"
+#include "quorum.h"
+#include "workspace.h"
 
 /** Broadcast collective operation that is based on (n-1) writes.
  *
@@ -19,6 +26,7 @@
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -28,11 +36,11 @@ gaspi_bcast_simple (segmentBuffer const buffer,
                     const gaspi_number_t elem_cnt,
                     const gaspi_number_t root,
                     const gaspi_queue_id_t queue_id,
-                    const gaspi_timeout_t timeout)
+                    const gaspi_timeout_t timeout,
+                    const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
     if (nProc <= 1)
         return GASPI_SUCCESS;
@@ -43,28 +51,32 @@ gaspi_bcast_simple (segmentBuffer const buffer,
     int segment_size = elem_cnt * type_size;
 
     gaspi_number_t doffset = buffer.offset * type_size;
+
+    // the window holds the data id k and the ack id nProc+k+1 of every process k
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, 2 * nProc + 1, &window) );
   
     if (iProc == root) {	
 	    for(uint k = 0; k < nProc; k++) {
     		if (k == root) 
 	    		continue;
 
-            gaspi_notification_id_t data_available = k;
-            write_notify_and_wait( buffer.segment, doffset, k
+            gaspi_notification_id_t data_available = window + k;
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset, k
 			          , buffer.segment, doffset, segment_size
 			          , data_available, k+1 // +1 so that the value is not zero
 			          , queue_id, timeout
-			);
+			) );
 	    }
     } else {
-        gaspi_notification_id_t data_available = iProc;
-  	    wait_or_die( buffer.segment, data_available, iProc+1 );  
+        gaspi_notification_id_t data_available = window + iProc;
+  	    SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, iProc+1, timeout ) );  
         // ackowledge parent that the data has arrived
-        gaspi_notification_id_t id = nProc + iProc + 1;
-        notify_and_wait( buffer.segment
+        gaspi_notification_id_t id = window + nProc + iProc + 1;
+        SUCCESS_OR_RETURN( notify_and_wait( comm, buffer.segment
                 , root, id, iProc+1
                 , queue_id, timeout
-        );
+        ) );
     }
 
     // wait for acknowledgement notifications 
@@ -72,8 +84,8 @@ gaspi_bcast_simple (segmentBuffer const buffer,
 	    for(uint k = 0; k < nProc; k++) {
 	    	if (k == root) 
 		    	continue;
-            gaspi_notification_id_t id = nProc + k + 1;
-  	        wait_or_die( buffer.segment, id, k+1 );
+            gaspi_notification_id_t id = window + nProc + k + 1;
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, k+1, timeout ) );
         } 
     }
 
@@ -88,6 +100,7 @@ gaspi_bcast_simple (segmentBuffer const buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -98,11 +111,11 @@ gaspi_bcast_simple (segmentBuffer const buffer,
                     const gaspi_double threshold,
                     const gaspi_number_t root,
                     const gaspi_queue_id_t queue_id,
-                    const gaspi_timeout_t timeout)
+                    const gaspi_timeout_t timeout,
+                    const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
     if (nProc <= 1)
         return GASPI_SUCCESS;
@@ -113,29 +126,169 @@ gaspi_bcast_simple (segmentBuffer const buffer,
     int segment_size = ceil(elem_cnt * threshold) * type_size;
 
     gaspi_number_t doffset = buffer.offset * type_size;
+
+    // the window holds the data id k and the ack id nProc+k+1 of every process k
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, 2 * nProc + 1, &window) );
  
     if (iProc == root) {	
 	    for(uint k = 0; k < nProc; k++) {
 	    	if (k == root) 
 		    	continue;
 
-            gaspi_notification_id_t data_available = k;
-			write_notify_and_wait( buffer.segment, doffset, k
+            gaspi_notification_id_t data_available = window + k;
+			SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset, k
 			        , buffer.segment, doffset, segment_size
 			        , data_available, root+1 // +1 so that the value is not zero
 			        , queue_id, timeout
-			);
+			) );
 	    }
     } else {
-        gaspi_notification_id_t data_available = iProc;
-    	wait_or_die( buffer.segment, data_available, root+1 );  
+        gaspi_notification_id_t data_available = window + iProc;
+    	SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, root+1, timeout ) );  
 
         // ackowledge parent that the data has arrived
-        gaspi_notification_id_t id = nProc + iProc + 1;
-        notify_and_wait( buffer.segment
+        gaspi_notification_id_t id = window + nProc + iProc + 1;
+        SUCCESS_OR_RETURN( notify_and_wait( comm, buffer.segment
                 , root, id, iProc+1
                 , queue_id, timeout
-        );
+        ) );
+    }
+
+    // wait for acknowledgement notifications 
+    if (iProc == root) {	
+	    for(uint k = 0; k < nProc; k++) {
+	    	if (k == root) 
+		    	continue;
+            gaspi_notification_id_t id = window + nProc + k + 1;
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, k+1, timeout ) );
+        } 
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent broadcast collective operation that is based on (n-1) straight gaspi_write with a rotating window
+ *
+ * A window which wraps around is broadcast in two parts.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_simple_window (segmentBuffer const buffer,
+                           const gaspi_number_t elem_cnt,
+                           const gaspi_double threshold,
+                           const gaspi_number_t iteration,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm)
+{
+    gaspi_number_t window_start, first_cnt, second_cnt;
+    partition_window(elem_cnt, threshold, iteration, window_start, first_cnt, second_cnt);
+
+    // the offset of the broadcast is given in elements
+    segmentBuffer const first = {buffer.segment, buffer.offset + window_start};
+    if (first_cnt > 0)
+        SUCCESS_OR_RETURN( gaspi_bcast_simple<T>(first, first_cnt, root, queue_id, timeout, comm) );
+    if (second_cnt > 0)
+        SUCCESS_OR_RETURN( gaspi_bcast_simple<T>(buffer, second_cnt, root, queue_id, timeout, comm) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent broadcast collective operation that is based on straight gaspi_write of pseudo-random blocks
+ *
+ * The root posts one gaspi_write per drawn block and peer on the queue and
+ * notifies every peer after its last block. The notification is posted on
+ * the same queue after the writes of the blocks, so it arrives after all of
+ * them. The notifications are the ones of gaspi_bcast_simple.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param block_elem_cnt The number of data elements of a block
+ * @param threshold The fraction of the blocks which are broadcast. The value is in [0, 1]
+ * @param seed The seed of the drawing, which is the same on all processes
+ * @param iteration The number of the call, which selects the blocks together with the seed
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_simple_sampled (segmentBuffer const buffer,
+                            const gaspi_number_t elem_cnt,
+                            const gaspi_number_t block_elem_cnt,
+                            const gaspi_double threshold,
+                            const gaspi_number_t seed,
+                            const gaspi_number_t iteration,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    gaspi_number_t doffset = buffer.offset * type_size;
+
+    // the window holds the data id k and the ack id nProc+k+1 of every process k
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, 2 * nProc + 1, &window) );
+
+    std::vector<gaspi_number_t> blocks;
+    partition_blocks(elem_cnt, block_elem_cnt, threshold, seed, iteration, blocks);
+    gaspi_number_t const block_size = MAX(block_elem_cnt, 1);
+
+    if (iProc == root) {	
+	    for(uint k = 0; k < nProc; k++) {
+	    	if (k == root) 
+		    	continue;
+
+            for (gaspi_number_t b : blocks) {
+                gaspi_number_t const block_start = b * block_size;
+                gaspi_number_t const block_offset = doffset + block_start * type_size;
+                SUCCESS_OR_RETURN( write_and_wait( comm, buffer.segment, block_offset, k
+                        , buffer.segment, block_offset, MIN(block_size, elem_cnt - block_start) * type_size
+                        , queue_id, timeout
+                ) );
+            }
+
+            gaspi_notification_id_t data_available = window + k;
+            SUCCESS_OR_RETURN( notify_and_wait( comm, buffer.segment
+                    , k, data_available, root+1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+	    }
+    } else {
+        gaspi_notification_id_t data_available = window + iProc;
+    	SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, root+1, timeout ) );  
+
+        // ackowledge parent that the data has arrived
+        gaspi_notification_id_t id = window + nProc + iProc + 1;
+        SUCCESS_OR_RETURN( notify_and_wait( comm, buffer.segment
+                , root, id, iProc+1
+                , queue_id, timeout
+        ) );
     }
 
     // wait for acknowledgement notifications 
@@ -143,8 +296,8 @@ gaspi_bcast_simple (segmentBuffer const buffer,
 	    for(uint k = 0; k < nProc; k++) {
 	    	if (k == root) 
 		    	continue;
-            gaspi_notification_id_t id = nProc + k + 1;
-  	        wait_or_die( buffer.segment, id, k+1 );
+            gaspi_notification_id_t id = window + nProc + k + 1;
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, k+1, timeout ) );
         } 
     }
 
@@ -158,6 +311,7 @@ gaspi_bcast_simple (segmentBuffer const buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout_ws Time out: ms, GASPI_BLOCK or GASPI_TEST
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -167,11 +321,11 @@ gaspi_bcast (segmentBuffer buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout)
+             const gaspi_timeout_t timeout,
+             const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
     if (nProc <= 1)
         return GASPI_SUCCESS;
@@ -183,65 +337,71 @@ gaspi_bcast (segmentBuffer buffer,
 
     gaspi_number_t doffset = buffer.offset * type_size;
 
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
     // compute parent
     // this can be omitted as the parent of each process can be found by flipping the leftmost 1-bit of its ID
     int j = 1;
-    while (j <= iProc)
+    while (j <= vrank)
         j = j * 2;
-    int parent = iProc - j / 2;
+    int parent = vrank - j / 2;
 
-    // broadcast
+    // the notifications are indexed by the level i of the child in the tree,
+    // i.e. the window has upper_bound ready ids, the ack id and the data id
     int upper_bound = ceil(log2(nProc));
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, upper_bound + 2, &window) );
+    gaspi_notification_id_t const ack = window + upper_bound;
+    gaspi_notification_id_t const data_available = window + upper_bound + 1;
+
+    // broadcast
     for (int i = 0; i < upper_bound; i++) {
         int pow2i = 1 << i;
-        if (iProc < pow2i) {
-            int dst = iProc + pow2i;
+        if (vrank < pow2i) {
+            int dst = vrank + pow2i;
             if (dst < nProc) {
                 // wait for notification that the data can be sent
-                gaspi_notification_id_t id = dst;
-                wait_or_die( buffer.segment, id, dst );  
+                gaspi_notification_id_t id = window + i;
+                SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, dst, timeout ) );  
 
                 // send the data
-                gaspi_notification_id_t data_available = iProc * nProc + dst;
-                write_notify_and_wait( buffer.segment, doffset, dst
+                SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset, (dst + root) % nProc
                         , buffer.segment, doffset, segment_size
-                        , data_available, iProc + 1// +1 so that the value is not zero
+                        , data_available, vrank + 1// +1 so that the value is not zero
                         , queue_id, timeout 
-                );
+                ) );
             }
-        } else if ((1 << (i+1)) > iProc) {
+        } else if ((1 << (i+1)) > vrank) {
 
             // need to send notification that the child is ready to receive the data
-            gaspi_notification_id_t id = iProc;
-            gaspi_notification_t val = iProc;
-            notify_and_wait(buffer.segment
-                    , parent, id, val
+            gaspi_notification_id_t id = window + i;
+            gaspi_notification_t val = vrank;
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                    , (parent + root) % nProc, id, val
                     , queue_id, timeout
-            );
+            ) );
 
             // wait for data to arrive
-            gaspi_notification_id_t data_available = parent * nProc + iProc;
-  	        wait_or_die( buffer.segment, data_available, parent+1 );  
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, parent+1, timeout ) );  
           
             if (i == (upper_bound - 1)) {
                 // ackowledge parent that the data has arrived
-                gaspi_notification_id_t id = iProc * nProc + parent;
-                gaspi_notification_t val = iProc;
-                notify_and_wait(buffer.segment
-                        , parent, id, val
+                gaspi_notification_t val = vrank;
+                SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                        , (parent + root) % nProc, ack, val
                         , queue_id, timeout
-                );
+                ) );
             }
         }
     }
 
     // waiting for acknowledgement notifications from children (only on the leaves)
     int pow2i = 1 << (upper_bound - 1);
-    if (iProc < pow2i) {
-        int src = iProc + pow2i;
+    if (vrank < pow2i) {
+        int src = vrank + pow2i;
         if (src < nProc) {
-            gaspi_notification_id_t id = src * nProc + iProc;
-  	        wait_or_die( buffer.segment, id, src );  
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, ack, src, timeout ) );  
         }
     }
  
@@ -256,6 +416,7 @@ gaspi_bcast (segmentBuffer buffer,
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
@@ -266,11 +427,11 @@ gaspi_bcast (segmentBuffer const buffer,
              const gaspi_double threshold,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout)
+             const gaspi_timeout_t timeout,
+             const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
     if (nProc <= 1)
         return GASPI_SUCCESS;
@@ -282,97 +443,171 @@ gaspi_bcast (segmentBuffer const buffer,
 
     gaspi_number_t doffset = buffer.offset * type_size;
 
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
     // compute parent
     // this can be omitted as the parent of each process can be found by flipping the leftmost 1-bit of its ID
     int j = 1;
-    while (j <= iProc)
+    while (j <= vrank)
         j = j * 2;
-    int parent = iProc - j / 2;
+    int parent = vrank - j / 2;
 
-    // broadcast
+    // the notifications are indexed by the level i of the child in the tree,
+    // i.e. the window has upper_bound ready ids, the ack id and the data id
     int upper_bound = ceil(log2(nProc));
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, upper_bound + 2, &window) );
+    gaspi_notification_id_t const ack = window + upper_bound;
+    gaspi_notification_id_t const data_available = window + upper_bound + 1;
+
+    // broadcast
     for (int i = 0; i < upper_bound; i++) {
         int pow2i = 1 << i;
-        if (iProc < pow2i) {
-            int dst = iProc + pow2i;
+        if (vrank < pow2i) {
+            int dst = vrank + pow2i;
             if (dst < nProc) {
                 // wait for notification that the data can be sent
-                gaspi_notification_id_t id = dst;
-                wait_or_die( buffer.segment, id, dst );  
+                gaspi_notification_id_t id = window + i;
+                SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, dst, timeout ) );  
 
                 // send the data
-                gaspi_notification_id_t data_available = iProc * nProc + dst;
-                write_notify_and_wait( buffer.segment, doffset, dst
+                SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset, (dst + root) % nProc
                         , buffer.segment, doffset, segment_size
-                        , data_available, iProc+1 // +1 so that the value is not zero
+                        , data_available, vrank+1 // +1 so that the value is not zero
                         , queue_id, timeout
-                );
+                ) );
             }
-        } else if ((1 << (i+1)) > iProc) {
+        } else if ((1 << (i+1)) > vrank) {
 
             // need to send notification that the child is ready to receive the data
-            gaspi_notification_id_t id = iProc;
-            gaspi_notification_t val = iProc;
-            notify_and_wait(buffer.segment
-                    , parent, id, val
+            gaspi_notification_id_t id = window + i;
+            gaspi_notification_t val = vrank;
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                    , (parent + root) % nProc, id, val
                     , queue_id, timeout
-            );
+            ) );
 
             // wait for data to arrive
-            gaspi_notification_id_t data_available = parent * nProc + iProc;
-  	        wait_or_die( buffer.segment, data_available, parent+1 );  
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, parent+1, timeout ) );  
           
             if (i == (upper_bound - 1)) {
                 // ackowledge parent that the data has arrived
-                gaspi_notification_id_t id = iProc * nProc + parent;
-                gaspi_notification_t val = iProc;
-                notify_and_wait(buffer.segment
-                        , parent, id, val
+                gaspi_notification_t val = vrank;
+                SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                        , (parent + root) % nProc, ack, val
                         , queue_id, timeout
-                );
+                ) );
             }
         }
     }
 
     // waiting for acknowledgement notificaitons from children (only on the leaves)
     int pow2i = 1 << (upper_bound - 1);
-    if (iProc < pow2i) {
-        int src = iProc + pow2i;
+    if (vrank < pow2i) {
+        int src = vrank + pow2i;
         if (src < nProc) {
-            gaspi_notification_id_t id = src * nProc + iProc;
-  	        wait_or_die( buffer.segment, id, src );  
+  	        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, ack, src, timeout ) );  
         }
     }
 
     return GASPI_SUCCESS;
 }
 
-/** Reduce collective operation that implements binomial tree
+/** Weakly consistent broadcast collective operation that uses binomial tree with a rotating window
  *
- * @param buffer_send Segment with offset of the original data
- * @param buffer_receive Segment with offset of the reduced data
- * @param elem_cnt The number of data elements in the buffer (beware of maximum - use gaspi_allreduce_elem_max).
- * @param operation The type of operations (MIN, MAX, SUM)
+ * A window which wraps around is broadcast in two parts.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, which selects the window
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
  */
-// TODO: I assume that we deal with all ranks [0,n-1] however it would be better to have them as in gaspi in rank_grp array
 template <typename T> gaspi_return_t 
-gaspi_reduce (const segmentBuffer buffer_send,
-   	          segmentBuffer buffer_receive,
-	          const gaspi_number_t elem_cnt,
-              const Operation & op,
-	          const gaspi_number_t root,
-              const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout)
+gaspi_bcast_window (segmentBuffer const buffer,
+                    const gaspi_number_t elem_cnt,
+                    const gaspi_double threshold,
+                    const gaspi_number_t iteration,
+                    const gaspi_number_t root,
+                    const gaspi_queue_id_t queue_id,
+                    const gaspi_timeout_t timeout,
+                    const collComm & comm)
+{
+    gaspi_number_t window_start, first_cnt, second_cnt;
+    partition_window(elem_cnt, threshold, iteration, window_start, first_cnt, second_cnt);
+
+    // the offset of the broadcast is given in elements
+    segmentBuffer const first = {buffer.segment, buffer.offset + window_start};
+    if (first_cnt > 0)
+        SUCCESS_OR_RETURN( gaspi_bcast<T>(first, first_cnt, root, queue_id, timeout, comm) );
+    if (second_cnt > 0)
+        SUCCESS_OR_RETURN( gaspi_bcast<T>(buffer, second_cnt, root, queue_id, timeout, comm) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Pipelined broadcast collective operation that uses binomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param chunk_elem_cnt The number of data elements per pipeline chunk
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_pipelined (segmentBuffer const buffer,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_number_t chunk_elem_cnt,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm)
+{
+    return gaspi_bcast_pipelined<T>(buffer, elem_cnt, 1.0, chunk_elem_cnt, root, queue_id, timeout, comm);
+}
+
+/** Weakly consistent pipelined broadcast collective operation that uses binomial tree.
+ *
+ * The data is split into chunks of chunk_elem_cnt elements and every chunk
+ * is written with its own notification, so that the inner nodes of the tree
+ * forward chunk k while chunk k+1 is still on its way.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param chunk_elem_cnt The number of data elements per pipeline chunk
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_pipelined (segmentBuffer const buffer,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_double threshold,
+                       const gaspi_number_t chunk_elem_cnt,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
     if (nProc <= 1)
         return GASPI_SUCCESS;
@@ -380,322 +615,2553 @@ gaspi_reduce (const segmentBuffer buffer_send,
     // type size
     int type_size = sizeof(T);
 
-    int segment_size = elem_cnt * type_size;
-
-    // compute parent
-    bst_struct bst;
-    int j = 1;
-    while (j <= iProc)
-        j = j * 2;
-    bst.parent = iProc - j / 2;
-    bst.children = (gaspi_rank_t *) valloc(sizeof(gaspi_rank_t) * (ceil(log2(nProc)) - 1));
-    bst.isactive = true;
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
 
-    // compute children
-    int children_count = 0;
-    int upper_bound = ceil(log2(nProc));
-    for (int i = 0; i < upper_bound; i++) {
-        if ((iProc == root) || (i > log2(iProc))) {
-            int k = iProc + (1 << i);
-            if ( k < nProc ) {
-                bst.children[children_count] = k;
-                children_count++;
-            }
-        }
-    }
-    bst.children_count = children_count;
+    gaspi_number_t doffset = buffer.offset * type_size;
 
-    // auxiliary pointers
-    gaspi_pointer_t src_array, rcv_array;
-    SUCCESS_OR_DIE( gaspi_segment_ptr (buffer_send.segment, &src_array) );
-    SUCCESS_OR_DIE( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
-    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
-    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+    // the notifications [0, nProc) of the window are used by the children to signal that
+    // they are ready, followed by one notification per chunk and nProc acknowledgement
+    // notifications, so the chunk length is increased if there are too many chunks
+    gaspi_number_t const notification_num = notification_available(comm, buffer.segment);
+    if (notification_num <= 2 * (gaspi_number_t) nProc)
+        return GASPI_ERROR;
+    gaspi_number_t max_chunks = notification_num - 2 * nProc;
 
-    // add temporary buffer
-    T *tmp_arr = NULL;
-    
-    // Copy the data to the output buffer to avoid modifying the input buffer
-    if (!children_count)
-        std::memcpy((void*) rcv_arr, (void*) src_arr, segment_size);
-    else {
-        tmp_arr = (T *) malloc(segment_size);
-        std::memcpy((void*) tmp_arr, (void*) src_arr, segment_size);
-    }
+    gaspi_number_t chunk_size = MAX(chunk_elem_cnt, 1);
+    if ((num_elem + chunk_size - 1) / chunk_size > max_chunks)
+        chunk_size = (num_elem + max_chunks - 1) / max_chunks;
+    gaspi_number_t num_chunks = (num_elem + chunk_size - 1) / chunk_size;
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, 2 * nProc + num_chunks, &window) );
 
-    // actual reduction
-    for (int i = upper_bound - 1; i >= 0; i--) {
-        int pow2i = 1 << i;
-        if (bst.isactive && (children_count == 0) && (pow2i <= iProc) && (iProc < (1 << (i+1)))) {
-            // wait for notification that the data can be sent
-            gaspi_rank_t rank = iProc * nProc + bst.parent;
-            gaspi_notification_id_t id = rank;
-            wait_or_die( buffer_send.segment, id, rank );
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
 
-            // write the data to the parent
-            gaspi_notification_id_t data_available = iProc;
-            write_notify_and_wait( buffer_receive.segment, buffer_receive.offset, bst.parent
-                    , buffer_receive.segment, buffer_receive.offset, segment_size
-                    , data_available, bst.parent + 1 // +1 so that the value is not zero
-                    , queue_id, timeout
-            );
-            
-            // wait for acknowledgement notification
-            gaspi_notification_id_t ack = bst.parent + 1;
-            wait_or_die( buffer_send.segment, ack, bst.parent + 1 );  
+    // compute parent by flipping the leftmost 1-bit of the process id
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    int parent = vrank - j / 2;
 
-            bst.isactive = false;
+    // compute children, the ones with the largest subtrees first
+    std::vector<gaspi_rank_t> children;
+    for (int pow2i = j; vrank + pow2i < nProc; pow2i = pow2i * 2)
+        children.push_back(vrank + pow2i);
 
-            if (tmp_arr)
-                free(tmp_arr);
+    // notify the parent that the data can be sent
+    if (vrank != 0) {
+        gaspi_notification_id_t id = window + vrank;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                , (parent + root) % nProc, id, vrank
+                , queue_id, timeout
+        ) );
+    }
 
-        } else if (bst.isactive && (pow2i > iProc) && ((iProc + pow2i) < nProc)) {
+    // wait for the children to be ready to receive the data
+    for (gaspi_rank_t child : children) {
+        gaspi_notification_id_t id = window + child;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, child, timeout ) );
+    }
 
-            // need to send notification that the parent is ready to receive the data
-            gaspi_rank_t rank = bst.children[children_count-1] * nProc + iProc;        
-            gaspi_notification_id_t id = rank;
-            notify_and_wait(buffer_send.segment
-                    , bst.children[children_count-1], id, rank
-                    , queue_id, timeout
-            );
-        
-            // receive data
-            gaspi_notification_t val;
-            waitsome_and_reset(buffer_receive.segment
-                , bst.children[0], nProc - bst.children[0]
-                , &id, &val
-            );
-            ASSERT(id >= bst.children[0]);
-            ASSERT(id <= bst.children[bst.children_count-1]);
+    // forward every chunk as soon as it has arrived
+    for (gaspi_number_t k = 0; k < num_chunks; k++) {
+        gaspi_number_t chunk_start = k * chunk_size;
+        gaspi_number_t chunk_offset = doffset + chunk_start * type_size;
+        gaspi_number_t chunk_bytes = MIN(chunk_size, num_elem - chunk_start) * type_size;
 
-            // local reduce
-            local_reduce<T>(op, elem_cnt, &rcv_arr[0], &tmp_arr[0]);
+        gaspi_notification_id_t data_available = window + nProc + k;
+        if (vrank != 0)
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, parent + 1, timeout ) );
 
-            // ackowledge child that the data has arrived
-            gaspi_notification_id_t ack = iProc + 1;
-            notify_and_wait(buffer_send.segment
-                    , bst.children[children_count - 1], ack, iProc + 1
+        for (gaspi_rank_t child : children) {
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, chunk_offset, (child + root) % nProc
+                    , buffer.segment, chunk_offset, chunk_bytes
+                    , data_available, vrank + 1 // +1 so that the value is not zero
                     , queue_id, timeout
-            );
+            ) );
+        }
+    }
 
-            children_count--;
+    // ackowledge parent that all the chunks have arrived
+    if (vrank != 0) {
+        gaspi_notification_id_t id = window + nProc + num_chunks + vrank;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                , (parent + root) % nProc, id, vrank + 1
+                , queue_id, timeout
+        ) );
+    }
 
-            // copy results to the receive buffer
-            if (!children_count)
-                std::memcpy((void*) rcv_arr, (void*) tmp_arr, segment_size);
-        }
+    // wait for acknowledgement notifications from children
+    for (gaspi_rank_t child : children) {
+        gaspi_notification_id_t id = window + nProc + num_chunks + child;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, child + 1, timeout ) );
     }
 
     return GASPI_SUCCESS;
 }
 
-/** Weakly consistent reduce collective operation that implements binomial tree
+/** Time-budget broadcast collective operation that uses a pipelined binomial tree.
  *
- * @param buffer_send Segment with offset of the original data
- * @param buffer_receive Segment with offset of the reduced data
- * @param elem_cnt The number of data elements in the buffer (beware of maximum - use gaspi_allreduce_elem_max).
- * @param operation The type of operations (MIN, MAX, SUM)
- * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * A process forwards every chunk as in gaspi_bcast_pipelined. Once the budget
+ * of the root is used up, the root sends the notification of the next chunk
+ * without data and with the value stop, which the processes forward instead
+ * of the chunk. The root waits for every chunk to leave its queue before it
+ * decides on the next one, so that it only sends what the network can carry
+ * within the budget.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param chunk_elem_cnt The number of data elements per pipeline chunk
+ * @param budget Time in milliseconds the root sends chunks (or GASPI_BLOCK for all chunks)
  * @param root The process id of the root
  * @param queue_id The queue id
  * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param completed The number of leading elements which have been broadcast
+ * @param comm The communicator
  *
  * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
  * error, GASPI_TIMEOUT in case of timeout.
  */
-// TODO: I assume that we deal with all ranks [0,n-1] however it would be better to have them as in gaspi in rank_grp array
 template <typename T> gaspi_return_t 
-gaspi_reduce (const segmentBuffer buffer_send,
-   	          segmentBuffer buffer_receive,
-	          const gaspi_number_t elem_cnt,
-              const Operation & op,
-              const gaspi_double threshold,
-	          const gaspi_number_t root,
-              const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout)
+gaspi_bcast_budget (segmentBuffer const buffer,
+                    const gaspi_number_t elem_cnt,
+                    const gaspi_number_t chunk_elem_cnt,
+                    const gaspi_timeout_t budget,
+                    const gaspi_number_t root,
+                    const gaspi_queue_id_t queue_id,
+                    const gaspi_timeout_t timeout,
+                    gaspi_number_t & completed,
+                    const collComm & comm)
 {
-    gaspi_rank_t iProc, nProc; 
-    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
-    SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
 
+    completed = elem_cnt;
     if (nProc <= 1)
         return GASPI_SUCCESS;
 
     // type size
     int type_size = sizeof(T);
 
-    int num_elem = ceil(elem_cnt * threshold);
-    int segment_size = num_elem * type_size;
+    gaspi_number_t num_elem = elem_cnt;
 
-    // compute parent
-    bst_struct bst;
+    gaspi_number_t doffset = buffer.offset * type_size;
+
+    // the notifications are used as in gaspi_bcast_pipelined
+    gaspi_number_t const notification_num = notification_available(comm, buffer.segment);
+    if (notification_num <= 2 * (gaspi_number_t) nProc)
+        return GASPI_ERROR;
+    gaspi_number_t max_chunks = notification_num - 2 * nProc;
+
+    gaspi_number_t chunk_size = MAX(chunk_elem_cnt, 1);
+    if ((num_elem + chunk_size - 1) / chunk_size > max_chunks)
+        chunk_size = (num_elem + max_chunks - 1) / max_chunks;
+    gaspi_number_t num_chunks = (num_elem + chunk_size - 1) / chunk_size;
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, 2 * nProc + num_chunks, &window) );
+
+    // the value of a chunk notification which stops the broadcast, it is
+    // larger than the value of any chunk
+    gaspi_notification_t const stop = nProc + 1;
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent by flipping the leftmost 1-bit of the process id
     int j = 1;
-    while (j <= iProc)
+    while (j <= vrank)
         j = j * 2;
-    bst.parent = iProc - j / 2;
-    bst.children = (gaspi_rank_t *) valloc(sizeof(gaspi_rank_t) * (ceil(log2(nProc)) - 1));
-    bst.isactive = true;
-
-    // compute children
-    int children_count = 0;
-    int upper_bound = ceil(log2(nProc));
-    for (int i = 0; i < upper_bound; i++) {
-        if ((iProc == root) || (i > log2(iProc))) {
-            int k = iProc + (1 << i);
-            if ( k < nProc ) {
-                bst.children[children_count] = k;
-                children_count++;
-            }
-        }
-    }
-    bst.children_count = children_count;
+    int parent = vrank - j / 2;
 
-    // auxiliary pointers
-    gaspi_pointer_t src_array, rcv_array;
-    SUCCESS_OR_DIE( gaspi_segment_ptr (buffer_send.segment, &src_array) );
-    SUCCESS_OR_DIE( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
-    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
-    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+    // compute children, the ones with the largest subtrees first
+    std::vector<gaspi_rank_t> children;
+    for (int pow2i = j; vrank + pow2i < nProc; pow2i = pow2i * 2)
+        children.push_back(vrank + pow2i);
 
-    // add temporary buffer
-    T *tmp_arr = NULL;
+    // notify the parent that the data can be sent
+    if (vrank != 0) {
+        gaspi_notification_id_t id = window + vrank;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                , (parent + root) % nProc, id, vrank
+                , queue_id, timeout
+        ) );
+    }
 
-    // Copy the data to the output buffer to avoid modifying the input buffer
-    if (!children_count)
-        std::memcpy((void*) rcv_arr, (void*) src_arr, segment_size);
-    else {
-        tmp_arr = (T *) malloc(segment_size);
-        std::memcpy((void*) tmp_arr, (void*) src_arr, segment_size);
+    // wait for the children to be ready to receive the data
+    for (gaspi_rank_t child : children) {
+        gaspi_notification_id_t id = window + child;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, child, timeout ) );
     }
 
-    // actual reduction
-    for (int i = upper_bound - 1; i >= 0; i--) {
-        int pow2i = 1 << i;
-        if (bst.isactive && (children_count == 0) && (pow2i <= iProc) && (iProc < (1 << (i+1)))) {
-            // wait for notification that the data can be sent
-            gaspi_rank_t rank = iProc * nProc + bst.parent;
-            gaspi_notification_id_t id = rank;
-            wait_or_die( buffer_send.segment, id, rank );
+    // forward every chunk as soon as it has arrived, until the root stops
+    gaspi_number_t num_sent = num_chunks;
+    for (gaspi_number_t k = 0; k < num_chunks; k++) {
+        gaspi_number_t chunk_start = k * chunk_size;
+        gaspi_number_t chunk_offset = doffset + chunk_start * type_size;
+        gaspi_number_t chunk_bytes = MIN(chunk_size, num_elem - chunk_start) * type_size;
 
-            // write the data to the parent
-            gaspi_notification_id_t data_available = iProc;
-            write_notify_and_wait( buffer_receive.segment, buffer_receive.offset, bst.parent
+        gaspi_notification_id_t data_available = window + nProc + k;
+        bool stopped;
+        if (vrank == 0) {
+            gaspi_timeout_t const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                                                (std::chrono::steady_clock::now() - start).count();
+            stopped = (budget != GASPI_BLOCK) && (elapsed >= budget);
+        } else {
+            gaspi_notification_t value;
+            SUCCESS_OR_RETURN( wait_and_reset( comm, buffer.segment, data_available, &value, timeout ) );
+            if ((value != stop) && (value != (gaspi_notification_t) (parent + 1)))
+                return GASPI_ERROR;
+            stopped = (value == stop);
+        }
+
+        if (stopped) {
+            for (gaspi_rank_t child : children) {
+                SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                        , (child + root) % nProc, data_available, stop
+                        , queue_id, timeout
+                ) );
+            }
+            num_sent = k;
+            break;
+        }
+
+        for (gaspi_rank_t child : children) {
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, chunk_offset, (child + root) % nProc
+                    , buffer.segment, chunk_offset, chunk_bytes
+                    , data_available, vrank + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+        }
+
+        if (vrank == 0)
+            SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+    }
+    completed = MIN(num_sent * chunk_size, num_elem);
+
+    // ackowledge parent that all the chunks have arrived
+    if (vrank != 0) {
+        gaspi_notification_id_t id = window + nProc + num_chunks + vrank;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                , (parent + root) % nProc, id, vrank + 1
+                , queue_id, timeout
+        ) );
+    }
+
+    // wait for acknowledgement notifications from children
+    for (gaspi_rank_t child : children) {
+        gaspi_notification_id_t id = window + nProc + num_chunks + child;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, child + 1, timeout ) );
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Broadcast collective operation that scatters the data along a binomial tree
+ * and gathers it back with a ring (van de Geijn).
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_scatter_allgather (segmentBuffer const buffer,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_number_t root,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm)
+{
+    return gaspi_bcast_scatter_allgather<T>(buffer, elem_cnt, 1.0, root, queue_id, timeout, comm);
+}
+
+/** Weakly consistent broadcast collective operation that scatters the data along
+ * a binomial tree and gathers it back with a ring (van de Geijn).
+ *
+ * The data is partitioned into nProc pieces. The root scatters them, so that
+ * process i ends up with piece i, and the pieces are then passed around a ring
+ * in (nProc-1) steps. Every process sends and receives about 2*elem_cnt elements
+ * instead of elem_cnt*log2(nProc) elements on the critical path of the binomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_scatter_allgather (segmentBuffer const buffer,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_double threshold,
+                               const gaspi_number_t root,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    gaspi_number_t doffset = buffer.offset * type_size;
+
+    // Partition elements of array into nProc pieces
+    std::vector<unsigned int> segment_sizes, segment_ends;
+    partition_chunks(num_elem, nProc, segment_sizes, segment_ends);
+
+    // the window holds the ready ids of the children, the data ids of the
+    // scatter and of the ring steps and the ready id of the ring
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, 2 * nProc + 1, &window) );
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent by clearing the lowest 1-bit of the process id,
+    // so that the subtree of every process holds the pieces [vrank, subtree_end)
+    int parent = 0;
+    int mask = 1;
+    while (mask < nProc) {
+        if (vrank & mask) {
+            parent = vrank - mask;
+            break;
+        }
+        mask = mask * 2;
+    }
+
+    // scatter
+    if (vrank != 0) {
+        // need to send notification that the child is ready to receive the data
+        gaspi_notification_id_t id = window + vrank;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                , (parent + root) % nProc, id, vrank
+                , queue_id, timeout
+        ) );
+
+        // wait for the pieces of the subtree to arrive
+        gaspi_notification_id_t data_available = window + nProc;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, parent + 1, timeout ) );
+    }
+
+    for (mask = mask / 2; mask > 0; mask = mask / 2) {
+        int child = vrank + mask;
+        if (child >= nProc)
+            continue;
+        int subtree_end = MIN(child + mask, nProc);
+
+        // wait for notification that the data can be sent
+        gaspi_notification_id_t id = window + child;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, child, timeout ) );
+
+        // send the pieces of the subtree of the child
+        gaspi_number_t piece_start = segment_ends[child] - segment_sizes[child];
+        gaspi_number_t piece_bytes = (segment_ends[subtree_end - 1] - piece_start) * type_size;
+        gaspi_notification_id_t data_available = window + nProc;
+        if (piece_bytes > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset + piece_start * type_size, (child + root) % nProc
+                    , buffer.segment, doffset + piece_start * type_size, piece_bytes
+                    , data_available, vrank + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                    , (child + root) % nProc, data_available, vrank + 1
+                    , queue_id, timeout
+            ) );
+        }
+    }
+
+    // Receive from left neighbor
+    const int recv_from = (iProc - 1 + nProc) % nProc;
+
+    // Send to right neighbor
+    const int send_to = (iProc + 1) % nProc;
+
+    // the scattered pieces must have left the buffer before the left neighbor writes into it
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    gaspi_notification_id_t ready = window + 2 * nProc;
+    SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+            , recv_from, ready, iProc + 1
+            , queue_id, timeout
+    ) );
+    SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, ready, send_to + 1, timeout ) );
+
+    // ring allgather
+    // At the i'th iteration, vrank sends piece (vrank - i) and receives piece (vrank - i - 1)
+    for (int i = 0; i < nProc - 1; i++) {
+        int send_chunk = (vrank - i + nProc) % nProc;
+
+        if (i > 0) {
+            // wait for the piece to be forwarded
+            gaspi_notification_id_t data_arr = window + nProc + i;
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_arr, recv_from + 1, timeout ) );
+        }
+
+        gaspi_number_t piece_start = segment_ends[send_chunk] - segment_sizes[send_chunk];
+        gaspi_notification_id_t data = window + nProc + i + 1;
+        if (segment_sizes[send_chunk] > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset + piece_start * type_size, send_to
+                    , buffer.segment, doffset + piece_start * type_size
+                    , segment_sizes[send_chunk] * type_size
+                    , data, iProc + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                    , send_to, data, iProc + 1
+                    , queue_id, timeout
+            ) );
+        }
+    }
+
+    // wait for the last piece
+    gaspi_notification_id_t data_arr = window + nProc + nProc - 1;
+    SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_arr, recv_from + 1, timeout ) );
+
+    // the buffer can be modified once the data has left it
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Broadcast collective operation that uses k-nomial tree.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_knomial (segmentBuffer const buffer,
+                     const gaspi_number_t elem_cnt,
+                     const gaspi_number_t radix,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout,
+                     const collComm & comm)
+{
+    return gaspi_bcast_knomial<T>(buffer, elem_cnt, 1.0, radix, root, queue_id, timeout, comm);
+}
+
+/** Weakly consistent broadcast collective operation that uses k-nomial tree.
+ *
+ * In round i every process that already has the data writes it to up to
+ * (radix-1) children at distance d * radix^i, d in [1, radix). The writes to
+ * all the children are posted back to back on the queue.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_knomial (segmentBuffer const buffer,
+                     const gaspi_number_t elem_cnt,
+                     const gaspi_double threshold,
+                     const gaspi_number_t radix,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout,
+                     const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    int segment_size = ceil(elem_cnt * threshold) * type_size;
+
+    gaspi_number_t doffset = buffer.offset * type_size;
+
+    // the window holds the ready ids of the children followed by the data id
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer.segment, nProc + 1, &window) );
+
+    // radix 2 is the binomial tree
+    int k = MAX(radix, 2);
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent by clearing the lowest non-zero digit of the process id in base k,
+    // the children are in the rounds below that digit
+    int step = 1;
+    while ((step < nProc) && ((vrank / step) % k == 0))
+        step = step * k;
+    int parent = vrank - ((vrank / step) % k) * step;
+
+    // compute children, the ones with the largest subtrees first
+    std::vector<gaspi_rank_t> children;
+    for (int s = step / k; s >= 1; s = s / k) {
+        for (int d = 1; d < k; d++) {
+            if (vrank + d * s >= nProc)
+                break;
+            children.push_back(vrank + d * s);
+        }
+    }
+
+    if (vrank != 0) {
+        // notify the parent that the data can be sent
+        gaspi_notification_id_t id = window + vrank;
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                , (parent + root) % nProc, id, vrank
+                , queue_id, timeout
+        ) );
+
+        // wait for data to arrive
+        gaspi_notification_id_t data_available = window + nProc;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, data_available, parent + 1, timeout ) );
+    }
+
+    // send the data to all the children without waiting for the previous writes
+    for (gaspi_rank_t child : children) {
+        gaspi_notification_id_t id = window + child;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer.segment, id, child, timeout ) );
+
+        gaspi_notification_id_t data_available = window + nProc;
+        if (segment_size > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer.segment, doffset, (child + root) % nProc
+                    , buffer.segment, doffset, segment_size
+                    , data_available, vrank + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer.segment
+                    , (child + root) % nProc, data_available, vrank + 1
+                    , queue_id, timeout
+            ) );
+        }
+    }
+
+    // the buffer can be modified once the data has left it
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer (beware of maximum - use gaspi_allreduce_elem_max).
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    int segment_size = elem_cnt * type_size;
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent
+    bst_struct bst;
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    bst.parent = vrank - j / 2;
+    int upper_bound = ceil(log2(nProc));
+    std::vector<gaspi_rank_t> children(upper_bound);
+    bst.children = children.data();
+    bst.isactive = true;
+
+    // compute children
+    int children_count = 0;
+    for (int i = 0; i < upper_bound; i++) {
+        if ((vrank == 0) || (i > log2(vrank))) {
+            int k = vrank + (1 << i);
+            if ( k < nProc ) {
+                bst.children[children_count] = k;
+                children_count++;
+            }
+        }
+    }
+    bst.children_count = children_count;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, rcv_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+
+    // add temporary buffer, which is released on every return
+    std::vector<T> tmp_buffer;
+    T *tmp_arr = NULL;
+    
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    if (!children_count)
+        std::memcpy((void*) rcv_arr, (void*) src_arr, segment_size);
+    else {
+        tmp_buffer.resize(segment_size / type_size);
+        tmp_arr = tmp_buffer.data();
+        std::memcpy((void*) tmp_arr, (void*) src_arr, segment_size);
+    }
+
+    // the parent notifies a child on its send segment that it is ready and
+    // that the data has arrived, and the child at level i of the tree sends
+    // its data with the notification i of the window of the receive segment
+    gaspi_notification_id_t window_send;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_send.segment, 2, &window_send) );
+    gaspi_notification_id_t window_receive;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, upper_bound, &window_receive) );
+    gaspi_notification_id_t const ready = window_send;
+    gaspi_notification_id_t const ack = window_send + 1;
+
+    // actual reduction
+    for (int i = upper_bound - 1; i >= 0; i--) {
+        int pow2i = 1 << i;
+        if (bst.isactive && (children_count == 0) && (pow2i <= vrank) && (vrank < (1 << (i+1)))) {
+            // wait for notification that the data can be sent
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_send.segment, ready, bst.parent + 1, timeout ) );
+
+            // write the data to the parent
+            gaspi_notification_id_t data_available = window_receive + i;
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer_receive.segment, buffer_receive.offset, (bst.parent + root) % nProc
                     , buffer_receive.segment, buffer_receive.offset, segment_size
                     , data_available, bst.parent + 1 // +1 so that the value is not zero
                     , queue_id, timeout
-            );
+            ) );
             
             // wait for acknowledgement notification
-            gaspi_notification_id_t ack = bst.parent + 1;
-            wait_or_die( buffer_send.segment, ack, bst.parent + 1 );  
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_send.segment, ack, bst.parent + 1, timeout ) );  
 
             bst.isactive = false;
 
-            if (tmp_arr)
-                free(tmp_arr);
+        } else if (bst.isactive && (pow2i > vrank) && ((vrank + pow2i) < nProc)) {
+
+            // need to send notification that the parent is ready to receive the data
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_send.segment
+                    , (bst.children[children_count-1] + root) % nProc, ready, vrank + 1
+                    , queue_id, timeout
+            ) );
+        
+            // receive data
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window_receive + i, vrank + 1, timeout ) );
+
+            // local reduce
+            local_reduce<T>(op, elem_cnt, &rcv_arr[0], &tmp_arr[0]);
+
+            // ackowledge child that the data has arrived
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_send.segment
+                    , (bst.children[children_count - 1] + root) % nProc, ack, vrank + 1
+                    , queue_id, timeout
+            ) );
+
+            children_count--;
+
+            // copy results to the receive buffer
+            if (!children_count)
+                std::memcpy((void*) rcv_arr, (void*) tmp_arr, segment_size);
+        }
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer (beware of maximum - use gaspi_allreduce_elem_max).
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_double threshold,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    int num_elem = ceil(elem_cnt * threshold);
+    int segment_size = num_elem * type_size;
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent
+    bst_struct bst;
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    bst.parent = vrank - j / 2;
+    int upper_bound = ceil(log2(nProc));
+    std::vector<gaspi_rank_t> children(upper_bound);
+    bst.children = children.data();
+    bst.isactive = true;
+
+    // compute children
+    int children_count = 0;
+    for (int i = 0; i < upper_bound; i++) {
+        if ((vrank == 0) || (i > log2(vrank))) {
+            int k = vrank + (1 << i);
+            if ( k < nProc ) {
+                bst.children[children_count] = k;
+                children_count++;
+            }
+        }
+    }
+    bst.children_count = children_count;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, rcv_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+
+    // add temporary buffer, which is released on every return
+    std::vector<T> tmp_buffer;
+    T *tmp_arr = NULL;
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    if (!children_count)
+        std::memcpy((void*) rcv_arr, (void*) src_arr, segment_size);
+    else {
+        tmp_buffer.resize(segment_size / type_size);
+        tmp_arr = tmp_buffer.data();
+        std::memcpy((void*) tmp_arr, (void*) src_arr, segment_size);
+    }
+
+    // the parent notifies a child on its send segment that it is ready and
+    // that the data has arrived, and the child at level i of the tree sends
+    // its data with the notification i of the window of the receive segment
+    gaspi_notification_id_t window_send;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_send.segment, 2, &window_send) );
+    gaspi_notification_id_t window_receive;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, upper_bound, &window_receive) );
+    gaspi_notification_id_t const ready = window_send;
+    gaspi_notification_id_t const ack = window_send + 1;
+
+    // actual reduction
+    for (int i = upper_bound - 1; i >= 0; i--) {
+        int pow2i = 1 << i;
+        if (bst.isactive && (children_count == 0) && (pow2i <= vrank) && (vrank < (1 << (i+1)))) {
+            // wait for notification that the data can be sent
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_send.segment, ready, bst.parent + 1, timeout ) );
+
+            // write the data to the parent
+            gaspi_notification_id_t data_available = window_receive + i;
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer_receive.segment, buffer_receive.offset, (bst.parent + root) % nProc
+                    , buffer_receive.segment, buffer_receive.offset, segment_size
+                    , data_available, bst.parent + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+            
+            // wait for acknowledgement notification
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_send.segment, ack, bst.parent + 1, timeout ) );  
+
+            bst.isactive = false;
+
+        } else if (bst.isactive && (pow2i > vrank) && ((vrank + pow2i) < nProc)) {
+
+            // need to send notification that the parent is ready to receive the data
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_send.segment
+                    , (bst.children[children_count-1] + root) % nProc, ready, vrank + 1
+                    , queue_id, timeout
+            ) );
+        
+            // receive data
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window_receive + i, vrank + 1, timeout ) );
+
+            // local reduce
+            local_reduce<T>(op, num_elem, &rcv_arr[0], &tmp_arr[0]);
+
+            // ackowledge child that the data has arrived
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_send.segment
+                    , (bst.children[children_count - 1] + root) % nProc, ack, vrank + 1
+                    , queue_id, timeout
+            ) );
+
+            children_count--;
+
+            // copy results to the receive buffer
+            if (!children_count)
+                std::memcpy((void*) rcv_arr, (void*) tmp_arr, segment_size);
+        }
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent reduce collective operation that implements binomial tree with a rotating window
+ *
+ * A window which wraps around is reduced in two parts.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_window (const segmentBuffer buffer_send,
+                     segmentBuffer buffer_receive,
+                     const gaspi_number_t elem_cnt,
+                     const Operation & op,
+                     const gaspi_double threshold,
+                     const gaspi_number_t iteration,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout,
+                     const collComm & comm)
+{
+    gaspi_number_t window_start, first_cnt, second_cnt;
+    partition_window(elem_cnt, threshold, iteration, window_start, first_cnt, second_cnt);
+
+    // the offsets of the reduce are given in bytes
+    int type_size = sizeof(T);
+    segmentBuffer const first_send = {buffer_send.segment, buffer_send.offset + window_start * type_size};
+    segmentBuffer const first_receive = {buffer_receive.segment, buffer_receive.offset + window_start * type_size};
+    if (first_cnt > 0)
+        SUCCESS_OR_RETURN( gaspi_reduce<T>(first_send, first_receive, first_cnt, op, root, queue_id, timeout, comm) );
+    if (second_cnt > 0)
+        SUCCESS_OR_RETURN( gaspi_reduce<T>(buffer_send, buffer_receive, second_cnt, op, root, queue_id, timeout, comm) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent reduce collective operation that implements binomial tree on pseudo-random blocks
+ *
+ * The tree and the notifications are the ones of the threshold gaspi_reduce,
+ * but a child posts one gaspi_write per drawn block into the receive buffer
+ * of its parent, followed by the data notification on the same queue, and
+ * the parent reduces only the drawn blocks.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param block_elem_cnt The number of data elements of a block
+ * @param threshold The fraction of the blocks which are reduced. The value is in [0, 1]
+ * @param seed The seed of the drawing, which is the same on all processes
+ * @param iteration The number of the call, which selects the blocks together with the seed
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_sampled (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t block_elem_cnt,
+                      const gaspi_double threshold,
+                      const gaspi_number_t seed,
+                      const gaspi_number_t iteration,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // type size
+    int type_size = sizeof(T);
+
+    std::vector<gaspi_number_t> blocks;
+    partition_blocks(elem_cnt, block_elem_cnt, threshold, seed, iteration, blocks);
+    gaspi_number_t const block_size = MAX(block_elem_cnt, 1);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, rcv_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+
+    // copy the drawn blocks from src to dst
+    auto copy_blocks = [&](T const *src, T *dst) {
+        for (gaspi_number_t b : blocks) {
+            gaspi_number_t const block_start = b * block_size;
+            std::memcpy((void*) &dst[block_start], (void*) &src[block_start]
+                       , MIN(block_size, elem_cnt - block_start) * type_size);
+        }
+    };
+
+    if (nProc <= 1) {
+        copy_blocks(src_arr, rcv_arr);
+        return GASPI_SUCCESS;
+    }
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent
+    bst_struct bst;
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    bst.parent = vrank - j / 2;
+    int upper_bound = ceil(log2(nProc));
+    std::vector<gaspi_rank_t> children(upper_bound);
+    bst.children = children.data();
+    bst.isactive = true;
+
+    // compute children
+    int children_count = 0;
+    for (int i = 0; i < upper_bound; i++) {
+        if ((vrank == 0) || (i > log2(vrank))) {
+            int k = vrank + (1 << i);
+            if ( k < nProc ) {
+                bst.children[children_count] = k;
+                children_count++;
+            }
+        }
+    }
+    bst.children_count = children_count;
+
+    // add temporary buffer, which is released on every return
+    std::vector<T> tmp_buffer;
+    T *tmp_arr = NULL;
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    if (!children_count)
+        copy_blocks(src_arr, rcv_arr);
+    else {
+        tmp_buffer.resize(elem_cnt);
+        tmp_arr = tmp_buffer.data();
+        copy_blocks(src_arr, tmp_arr);
+    }
+
+    // the notifications are used as in gaspi_reduce
+    gaspi_notification_id_t window_send;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_send.segment, 2, &window_send) );
+    gaspi_notification_id_t window_receive;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_receive.segment, upper_bound, &window_receive) );
+    gaspi_notification_id_t const ready = window_send;
+    gaspi_notification_id_t const ack = window_send + 1;
+
+    // actual reduction
+    for (int i = upper_bound - 1; i >= 0; i--) {
+        int pow2i = 1 << i;
+        if (bst.isactive && (children_count == 0) && (pow2i <= vrank) && (vrank < (1 << (i+1)))) {
+            // wait for notification that the data can be sent
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_send.segment, ready, bst.parent + 1, timeout ) );
+
+            // write the drawn blocks to the parent
+            gaspi_rank_t const parent_rank = (bst.parent + root) % nProc;
+            for (gaspi_number_t b : blocks) {
+                gaspi_number_t const block_start = b * block_size;
+                gaspi_number_t const block_offset = buffer_receive.offset + block_start * type_size;
+                SUCCESS_OR_RETURN( write_and_wait( comm, buffer_receive.segment, block_offset, parent_rank
+                        , buffer_receive.segment, block_offset, MIN(block_size, elem_cnt - block_start) * type_size
+                        , queue_id, timeout
+                ) );
+            }
+
+            gaspi_notification_id_t data_available = window_receive + i;
+            SUCCESS_OR_RETURN( notify_and_wait( comm, buffer_receive.segment
+                    , parent_rank, data_available, bst.parent + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+            
+            // wait for acknowledgement notification
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_send.segment, ack, bst.parent + 1, timeout ) );  
+
+            bst.isactive = false;
+
+        } else if (bst.isactive && (pow2i > vrank) && ((vrank + pow2i) < nProc)) {
+
+            // need to send notification that the parent is ready to receive the data
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_send.segment
+                    , (bst.children[children_count-1] + root) % nProc, ready, vrank + 1
+                    , queue_id, timeout
+            ) );
+        
+            // receive data
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_receive.segment, window_receive + i, vrank + 1, timeout ) );
+
+            // local reduce of the drawn blocks
+            for (gaspi_number_t b : blocks) {
+                gaspi_number_t const block_start = b * block_size;
+                local_reduce<T>(op, MIN(block_size, elem_cnt - block_start), &rcv_arr[block_start], &tmp_arr[block_start]);
+            }
+
+            // ackowledge child that the data has arrived
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_send.segment
+                    , (bst.children[children_count - 1] + root) % nProc, ack, vrank + 1
+                    , queue_id, timeout
+            ) );
+
+            children_count--;
+
+            // copy results to the receive buffer
+            if (!children_count)
+                copy_blocks(tmp_arr, rcv_arr);
+        }
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent sum of the leading elements with error feedback
+ *
+ * The reduce reads the data from the residual, to which the data has been
+ * added. Its leading elements are cleared once the reduce has returned, so
+ * a reduce which fails leaves the data of the call in the residual.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_residual Segment with offset of the residual of the process (elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_feedback (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       segmentBuffer buffer_residual,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_double threshold,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       const gaspi_timeout_t timeout,
+                       const collComm & comm)
+{
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, res_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_residual.segment, &res_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *res_arr = (T *)((char*)res_array + buffer_residual.offset);
+
+    local_reduce<T>(SUM, elem_cnt, src_arr, res_arr);
+
+    SUCCESS_OR_RETURN( gaspi_reduce<T>(buffer_residual, buffer_receive, elem_cnt, SUM, threshold, root, queue_id, timeout, comm) );
+
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+    std::memset((void*) res_arr, 0, num_elem * type_size);
+
+    return GASPI_SUCCESS;
+}
+
+/** Weakly consistent sum of a rotating window with error feedback
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_residual Segment with offset of the residual of the process (elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call, which selects the window
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_window_feedback (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              segmentBuffer buffer_residual,
+                              const gaspi_number_t elem_cnt,
+                              const gaspi_double threshold,
+                              const gaspi_number_t iteration,
+                              const gaspi_number_t root,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm)
+{
+    // type size
+    int type_size = sizeof(T);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, res_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_residual.segment, &res_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *res_arr = (T *)((char*)res_array + buffer_residual.offset);
+
+    local_reduce<T>(SUM, elem_cnt, src_arr, res_arr);
+
+    SUCCESS_OR_RETURN( gaspi_reduce_window<T>(buffer_residual, buffer_receive, elem_cnt, SUM, threshold, iteration, root, queue_id, timeout, comm) );
+
+    // clear both parts of the window
+    gaspi_number_t window_start, first_cnt, second_cnt;
+    partition_window(elem_cnt, threshold, iteration, window_start, first_cnt, second_cnt);
+    std::memset((void*) &res_arr[window_start], 0, first_cnt * type_size);
+    std::memset((void*) res_arr, 0, second_cnt * type_size);
+
+    return GASPI_SUCCESS;
+}
+
+/** Reduce collective operation that implements k-nomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data ((radix-1)*elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_knomial (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      segmentBuffer buffer_tmp,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t radix,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    return gaspi_reduce_knomial<T>(buffer_send, buffer_receive, buffer_tmp, elem_cnt, op, 1.0, radix, root, queue_id, timeout, comm);
+}
+
+/** Weakly consistent reduce collective operation that implements k-nomial tree
+ *
+ * In every round the (radix-1) children of a process write their partial
+ * results concurrently into their own slots of buffer_tmp. The slots are
+ * reduced in the order of the children, so the result does not depend on
+ * the arrival order.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data ((radix-1)*elem_cnt elements)
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param radix The radix of the tree, i.e. every process has up to (radix-1) children per round
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_knomial (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      segmentBuffer buffer_tmp,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_number_t radix,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      const gaspi_timeout_t timeout,
+                      const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // type size
+    int type_size = sizeof(T);
+
+    int num_elem = ceil(elem_cnt * threshold);
+    int segment_size = num_elem * type_size;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, rcv_array, tmp_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_tmp.segment, &tmp_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+    T *tmp_arr = (T *)((char*)tmp_array + buffer_tmp.offset);
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    std::memcpy((void*) rcv_arr, (void*) src_arr, segment_size);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // the window holds the data id of every child followed by the ready id of every child
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( notification_window(comm, buffer_tmp.segment, 2 * nProc, &window) );
+
+    // radix 2 is the binomial tree
+    int k = MAX(radix, 2);
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent by clearing the lowest non-zero digit of the process id in base k,
+    // the children are in the rounds below that digit
+    int step = 1;
+    while ((step < nProc) && ((vrank / step) % k == 0))
+        step = step * k;
+    int parent = vrank - ((vrank / step) % k) * step;
+    // slot in the temporary buffer of the parent
+    int slot = (vrank / step) % k - 1;
+
+    // actual reduction, the rounds with the smallest subtrees first
+    for (int s = 1; s < step; s = s * k) {
+        // notify the children of this round that their slots can be written
+        for (int d = 1; d < k && vrank + d * s < nProc; d++) {
+            int child = vrank + d * s;
+            gaspi_notification_id_t id = window + nProc + child;
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_tmp.segment
+                    , (child + root) % nProc, id, vrank + 1
+                    , queue_id, timeout
+            ) );
+        }
+
+        // local reduce in the order of the children
+        for (int d = 1; d < k && vrank + d * s < nProc; d++) {
+            int child = vrank + d * s;
+            gaspi_notification_id_t data_available = window + child;
+            SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_tmp.segment, data_available, child + 1, timeout ) );
+
+            local_reduce<T>(op, num_elem, &tmp_arr[(d - 1) * num_elem], &rcv_arr[0]);
+        }
+    }
+
+    if (vrank != 0) {
+        // wait for notification that the data can be sent
+        gaspi_notification_id_t id = window + nProc + vrank;
+        SUCCESS_OR_RETURN( wait_or_timeout( comm, buffer_tmp.segment, id, parent + 1, timeout ) );
+
+        // write the partial result to the slot of the parent
+        gaspi_notification_id_t data_available = window + vrank;
+        if (segment_size > 0) {
+            SUCCESS_OR_RETURN( write_notify_and_wait( comm, buffer_receive.segment, buffer_receive.offset, (parent + root) % nProc
+                    , buffer_tmp.segment, buffer_tmp.offset + slot * segment_size, segment_size
+                    , data_available, vrank + 1 // +1 so that the value is not zero
+                    , queue_id, timeout
+            ) );
+        } else {
+            SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_tmp.segment
+                    , (parent + root) % nProc, data_available, vrank + 1
+                    , queue_id, timeout
+            ) );
+        }
+
+        // the buffer can be modified once the data has left it
+        SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Quorum reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced, only set at the root
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_quorum (const segmentBuffer buffer_send,
+                     segmentBuffer buffer_receive,
+                     segmentBuffer buffer_tmp,
+                     const gaspi_number_t elem_cnt,
+                     const Operation & op,
+                     const gaspi_double quorum,
+                     const gaspi_timeout_t deadline,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout,
+                     std::vector<gaspi_rank_t> & included,
+                     const collComm & comm)
+{
+    return gaspi_reduce_quorum<T>(buffer_send, buffer_receive, buffer_tmp, elem_cnt, op, 1.0, quorum, deadline
+                                 , root, queue_id, timeout, included, comm);
+}
+
+/** Weakly consistent quorum reduce collective operation that implements binomial tree
+ *
+ * The child at level i of a process writes its partial result and the flags
+ * of the processes it includes to slot i of the temporary buffer of the
+ * process, the last slot holds the partial result of the process itself.
+ * Every notification carries the number of the call, so that a contribution
+ * of an earlier call, which has missed its deadline, is recognized and
+ * dropped.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced, only set at the root
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_quorum (const segmentBuffer buffer_send,
+                     segmentBuffer buffer_receive,
+                     segmentBuffer buffer_tmp,
+                     const gaspi_number_t elem_cnt,
+                     const Operation & op,
+                     const gaspi_double threshold,
+                     const gaspi_double quorum,
+                     const gaspi_timeout_t deadline,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     const gaspi_timeout_t timeout,
+                     std::vector<gaspi_rank_t> & included,
+                     const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    included.clear();
+    if (nProc <= 1) {
+        included.push_back(iProc);
+        return GASPI_SUCCESS;
+    }
+
+    // type size
+    int type_size = sizeof(T);
+
+    // number of elements to be reduced
+    int num_elem = ceil(elem_cnt * threshold);
+    int segment_size = num_elem * type_size;
+
+    // a slot holds the data followed by a flag for every process
+    gaspi_size_t const data_size = ((segment_size + 7) / 8) * 8;
+    gaspi_size_t const slot_size = data_size + ((nProc * sizeof(int) + 7) / 8) * 8;
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+    int upper_bound = ceil(log2(nProc));
+
+    // the notification i of the window of buffer_tmp announces the data of
+    // the child at level i, the notification upper_bound that the parent is
+    // ready. Late contributions can arrive at any time, so the window is
+    // reserved for the quorum collectives on the segment by the first call
+    quorumState & state = quorum_state(comm, buffer_tmp.segment);
+    if (!state.reserved) {
+        SUCCESS_OR_RETURN( notification_window(comm, buffer_tmp.segment, upper_bound + 1, &state.window) );
+        notification_reserve(comm.group, buffer_tmp.segment, state.window, upper_bound + 1);
+        state.reserved = true;
+    }
+    gaspi_notification_id_t const window = state.window;
+    gaspi_notification_id_t const ready = window + upper_bound;
+
+    // the parent is vrank without its highest bit, the children are vrank
+    // plus the powers of two from j on, and the subtree consists of the
+    // processes which are equal to vrank modulo j
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    int parent = vrank - j / 2;
+    int level = 0;
+    while ((2 << level) < j)
+        level++;
+
+    std::vector<int> children_levels;
+    for (int i = 0; i < upper_bound; i++) {
+        if (((1 << i) >= j) && ((vrank + (1 << i)) < nProc))
+            children_levels.push_back(i);
+    }
+
+    gaspi_number_t subtree_size = 0;
+    for (int k = vrank; k < nProc; k += j)
+        subtree_size++;
+    gaspi_number_t const required = ceil(quorum * subtree_size);
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, rcv_array, tmp_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_tmp.segment, &tmp_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+    char *tmp_arr = (char *)tmp_array + buffer_tmp.offset;
+
+    // the root reduces into the receive buffer, the other processes into
+    // their last slot, which they send to the parent
+    gaspi_offset_t const own_slot = upper_bound * slot_size;
+    T *acc_arr = (vrank == 0) ? rcv_arr : (T *) &tmp_arr[own_slot];
+    int *acc_flags = (int *) &tmp_arr[own_slot + data_size];
+    std::memcpy((void*) acc_arr, (void*) src_arr, segment_size);
+    std::memset((void*) acc_flags, 0, nProc * sizeof(int));
+    acc_flags[iProc] = 1;
+    gaspi_number_t contributed = 1;
+
+    gaspi_notification_t const sequence = ++state.sequence;
+
+    // the children may write to their slots from now on
+    for (int c : children_levels) {
+        SUCCESS_OR_RETURN( notify_and_wait(comm, buffer_tmp.segment
+                , (vrank + (1 << c) + root) % nProc, ready, sequence
+                , queue_id, timeout
+        ) );
+    }
+
+    // reduce the contributions in the order of their arrival
+    std::vector<bool> arrived(upper_bound, false);
+    gaspi_number_t num_arrived = 0;
+    bool timed_out = false;
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    while (num_arrived < children_levels.size()) {
+        gaspi_timeout_t const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                                            (std::chrono::steady_clock::now() - start).count();
+        bool const expired = (deadline != GASPI_BLOCK) && (elapsed >= deadline);
+        if (expired && (contributed >= required))
+            break;
+
+        // the timeout is reported once the contributions which have already
+        // arrived are reduced
+        if (timed_out)
+            return GASPI_TIMEOUT;
+
+        // wait until the deadline, and after it until the quorum is reached,
+        // once the timeout has passed only the arrived notifications are tested
+        gaspi_timeout_t wait_ms = (expired || (deadline == GASPI_BLOCK)) ? GASPI_BLOCK : deadline - elapsed;
+        bool last_attempt = false;
+        if (timeout != GASPI_BLOCK) {
+            last_attempt = (elapsed >= timeout);
+            wait_ms = last_attempt ? GASPI_TEST : MIN(wait_ms, timeout - elapsed);
+        }
+
+        gaspi_notification_id_t id;
+        gaspi_return_t ret = gaspi_notify_waitsome(buffer_tmp.segment, comm.notification_offset + window
+                                                  , upper_bound, &id, wait_ms);
+        if (ret == GASPI_TIMEOUT) {
+            timed_out = last_attempt;
+            continue;
+        }
+        if (ret != GASPI_SUCCESS)
+            return ret;
+
+        gaspi_notification_t value;
+        SUCCESS_OR_RETURN( gaspi_notify_reset(buffer_tmp.segment, id, &value) );
+
+        // a contribution of an earlier call is dropped
+        gaspi_number_t const i = id - comm.notification_offset - window;
+        if ((value != sequence) || arrived[i])
+            continue;
+        arrived[i] = true;
+        num_arrived++;
+
+        local_reduce<T>(op, num_elem, (T const *) &tmp_arr[i * slot_size], acc_arr);
+        int const *child_flags = (int const *) &tmp_arr[i * slot_size + data_size];
+        for (gaspi_rank_t p = 0; p < nProc; p++) {
+            if (child_flags[p]) {
+                acc_flags[p] = 1;
+                contributed++;
+            }
+        }
+    }
+
+    if (vrank == 0) {
+        for (gaspi_rank_t p = 0; p < nProc; p++) {
+            if (acc_flags[p])
+                included.push_back(p);
+        }
+        return GASPI_SUCCESS;
+    }
+
+    // a parent which is already in a later call has dropped the contribution
+    // and its ready notification is kept for the later call
+    if (state.ready < sequence) {
+        gaspi_notification_id_t id;
+        SUCCESS_OR_RETURN( gaspi_notify_waitsome(buffer_tmp.segment, comm.notification_offset + ready
+                                                , 1, &id, timeout) );
+        SUCCESS_OR_RETURN( gaspi_notify_reset(buffer_tmp.segment, id, &state.ready) );
+    }
+    if (state.ready == sequence) {
+        SUCCESS_OR_RETURN( write_notify_and_wait(comm, buffer_tmp.segment, buffer_tmp.offset + own_slot
+                , (parent + root) % nProc, buffer_tmp.segment, buffer_tmp.offset + level * slot_size, slot_size
+                , window + level, sequence
+                , queue_id, timeout
+        ) );
+    }
+
+    // the slot can be modified once the data has left it
+    SUCCESS_OR_RETURN( gaspi_wait(queue_id, timeout) );
+
+    return GASPI_SUCCESS;
+}
+
+/** Quorum allreduce collective operation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data of the quorum reduce
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_allreduce_quorum (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        segmentBuffer buffer_tmp,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_double quorum,
+                        const gaspi_timeout_t deadline,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout,
+                        std::vector<gaspi_rank_t> & included,
+                        const collComm & comm)
+{
+    return gaspi_allreduce_quorum<T>(buffer_send, buffer_receive, buffer_tmp, elem_cnt, op, 1.0, quorum, deadline
+                                    , queue_id, timeout, included, comm);
+}
+
+/** Weakly consistent quorum allreduce collective operation
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param buffer_tmp Segment with offset of the temporary data of the quorum reduce
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param quorum The fraction of the processes which have to contribute. The value is in [0, 1]
+ * @param deadline Time in milliseconds a process waits for late children once the quorum is reached (or GASPI_BLOCK)
+ * @param queue_id The queue id
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST).
+ * @param included The ranks of the processes whose data has been reduced
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+template <typename T> gaspi_return_t 
+gaspi_allreduce_quorum (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        segmentBuffer buffer_tmp,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_double threshold,
+                        const gaspi_double quorum,
+                        const gaspi_timeout_t deadline,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout,
+                        std::vector<gaspi_rank_t> & included,
+                        const collComm & comm)
+{
+    gaspi_rank_t const nProc = comm.size;
+
+    SUCCESS_OR_RETURN( gaspi_reduce_quorum<T>(buffer_send, buffer_receive, buffer_tmp, elem_cnt, op, threshold
+                                             , quorum, deadline, 0, queue_id, timeout, included, comm) );
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    gaspi_number_t const num_elem = ceil(elem_cnt * threshold);
+
+    // the offset of the broadcast is given in elements
+    segmentBuffer const buffer_result = {buffer_receive.segment, buffer_receive.offset / sizeof(T)};
+    SUCCESS_OR_RETURN( gaspi_bcast<T>(buffer_result, num_elem, 0, queue_id, timeout, comm) );
+
+    // the flags of the included processes follow through the workspace
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_RETURN( workspace_segment(comm, nProc * sizeof(int), timeout, &tmp_segment, &tmp_arr) );
+    int *flags = (int *) tmp_arr;
+
+    if (comm.rank == 0) {
+        std::memset((void*) flags, 0, nProc * sizeof(int));
+        for (gaspi_rank_t p : included)
+            flags[p] = 1;
+    }
+
+    segmentBuffer const buffer_flags = {tmp_segment, 0};
+    SUCCESS_OR_RETURN( gaspi_bcast<int>(buffer_flags, nProc, 0, queue_id, timeout, comm) );
+
+    included.clear();
+    for (gaspi_rank_t p = 0; p < nProc; p++) {
+        if (flags[p])
+            included.push_back(p);
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Plan of a persistent broadcast collective operation that uses binomial tree
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_init (segmentBuffer const buffer,
+                  const gaspi_number_t elem_cnt,
+                  const gaspi_number_t root,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm)
+{
+    return gaspi_bcast_init<T>(buffer, elem_cnt, 1.0, root, queue_id, request, comm);
+}
+
+/** Plan of a weakly consistent persistent broadcast collective operation that uses binomial tree
+ *
+ * The notifications are indexed by the level of the children in the tree.
+ * The plan is computed once, every gaspi_request_start runs the broadcast.
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_bcast_init (segmentBuffer const buffer,
+                  const gaspi_number_t elem_cnt,
+                  const gaspi_double threshold,
+                  const gaspi_number_t root,
+                  const gaspi_queue_id_t queue_id,
+                  collRequest & request,
+                  const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    request_init(request, queue_id, SUM);
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    gaspi_number_t num_elem = ceil(elem_cnt * threshold);
+
+    gaspi_number_t doffset = buffer.offset * type_size;
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent by flipping the leftmost 1-bit of the process id
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    int parent = vrank - j / 2;
+
+    // compute children and their levels in the tree, i.e. child = vrank + 2^level,
+    // the ones with the smallest subtrees first. The process itself is the
+    // child of its parent at the level below the one of its first child
+    int first_level = 0;
+    while ((1 << first_level) < j)
+        first_level++;
+    std::vector<gaspi_rank_t> children;
+    std::vector<int> levels;
+    for (int level = first_level; vrank + (1 << level) < nProc; level++) {
+        children.push_back(vrank + (1 << level));
+        levels.push_back(level);
+    }
+
+    // the notifications are indexed by the level of the child, i.e. the window
+    // has upper_bound ready ids, the data id and upper_bound ack ids
+    int upper_bound = ceil(log2(nProc));
+    gaspi_notification_id_t window;
+    SUCCESS_OR_RETURN( request_window(request, comm, buffer.segment, 2 * upper_bound + 1, &window) );
+    gaspi_notification_id_t const data_available = window + upper_bound;
+    gaspi_notification_id_t const ack = window + upper_bound + 1;
+
+    // notify the parent that the data can be sent
+    if (vrank != 0)
+        request_notify(request, comm, buffer.segment, (parent + root) % nProc, window + first_level - 1, vrank);
+
+    // wait for the children to be ready to receive the data
+    for (std::size_t c = 0; c < children.size(); c++)
+        request_wait(request, comm, buffer.segment, window + levels[c], children[c]);
+
+    // forward the data once it has arrived
+    if (vrank != 0)
+        request_wait(request, comm, buffer.segment, data_available, parent + 1);
+
+    for (gaspi_rank_t child : children) {
+        request_write(request, comm, buffer.segment, doffset, (child + root) % nProc
+                , buffer.segment, doffset, num_elem * type_size
+                , data_available, vrank + 1 // +1 so that the value is not zero
+        );
+    }
+
+    // ackowledge parent that the data has arrived
+    if (vrank != 0)
+        request_notify(request, comm, buffer.segment, (parent + root) % nProc, ack + first_level - 1, vrank + 1);
+
+    // wait for acknowledgement notifications from children
+    for (std::size_t c = 0; c < children.size(); c++)
+        request_wait(request, comm, buffer.segment, ack + levels[c], children[c] + 1);
+
+    request_flush(request);
+
+    return GASPI_SUCCESS;
+}
+
+/** Nonblocking broadcast collective operation that uses binomial tree
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which is advanced by gaspi_request_test/gaspi_request_wait
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ibcast (segmentBuffer const buffer,
+              const gaspi_number_t elem_cnt,
+              const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+              collRequest & request,
+              const collComm & comm)
+{
+    return gaspi_ibcast<T>(buffer, elem_cnt, 1.0, root, queue_id, request, comm);
+}
+
+/** Weakly consistent nonblocking broadcast collective operation that uses binomial tree
+ *
+ * @param buffer Segment with offset of the original data
+ * @param elem_cnt The number of data elements
+ * @param threshold The threshold for the amount of data to be broadcasted. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which is advanced by gaspi_request_test/gaspi_request_wait
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ibcast (segmentBuffer const buffer,
+              const gaspi_number_t elem_cnt,
+              const gaspi_double threshold,
+              const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+              collRequest & request,
+              const collComm & comm)
+{
+    SUCCESS_OR_RETURN( gaspi_bcast_init<T>(buffer, elem_cnt, threshold, root, queue_id, request, comm) );
+
+    return gaspi_request_start(request);
+}
+
+/** Plan of a persistent reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_init (const segmentBuffer buffer_send,
+                   segmentBuffer buffer_receive,
+                   const gaspi_number_t elem_cnt,
+                   const Operation & op,
+                   const gaspi_number_t root,
+                   const gaspi_queue_id_t queue_id,
+                   collRequest & request,
+                   const collComm & comm)
+{
+    return gaspi_reduce_init<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, root, queue_id, request, comm);
+}
+
+/** Plan of a weakly consistent persistent reduce collective operation that implements binomial tree
+ *
+ * The notifications are the ones of gaspi_reduce, in windows of their own.
+ * The plan is computed once, every gaspi_request_start runs the reduce.
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which holds the plan
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_reduce_init (const segmentBuffer buffer_send,
+                   segmentBuffer buffer_receive,
+                   const gaspi_number_t elem_cnt,
+                   const Operation & op,
+                   const gaspi_double threshold,
+                   const gaspi_number_t root,
+                   const gaspi_queue_id_t queue_id,
+                   collRequest & request,
+                   const collComm & comm)
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    request_init(request, queue_id, op);
+    request.reduce = request_local_reduce<T>;
+
+    if (nProc <= 1)
+        return GASPI_SUCCESS;
+
+    // type size
+    int type_size = sizeof(T);
+
+    int num_elem = ceil(elem_cnt * threshold);
+    int segment_size = num_elem * type_size;
+
+    // virtual rank of the process in the tree which is rooted at 0
+    int vrank = (iProc - root + nProc) % nProc;
+
+    // compute parent by flipping the leftmost 1-bit of the process id
+    int j = 1;
+    while (j <= vrank)
+        j = j * 2;
+    int parent = vrank - j / 2;
+
+    // compute children and their levels in the tree, i.e. child = vrank + 2^level,
+    // the ones with the smallest subtrees first. The process itself is the
+    // child of its parent at the level below the one of its first child
+    int first_level = 0;
+    while ((1 << first_level) < j)
+        first_level++;
+    std::vector<gaspi_rank_t> children;
+    std::vector<int> levels;
+    for (int level = first_level; vrank + (1 << level) < nProc; level++) {
+        children.push_back(vrank + (1 << level));
+        levels.push_back(level);
+    }
+
+    // the ready and the ack notification of the parent on the send segment,
+    // and the data of the children indexed by their level on the receive segment
+    int upper_bound = ceil(log2(nProc));
+    gaspi_notification_id_t window_send;
+    SUCCESS_OR_RETURN( request_window(request, comm, buffer_send.segment, 2, &window_send) );
+    gaspi_notification_id_t window_receive;
+    SUCCESS_OR_RETURN( request_window(request, comm, buffer_receive.segment, upper_bound, &window_receive) );
+    gaspi_notification_id_t const ready = window_send;
+    gaspi_notification_id_t const ack = window_send + 1;
+
+    // auxiliary pointers
+    gaspi_pointer_t src_array, rcv_array;
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_send.segment, &src_array) );
+    SUCCESS_OR_RETURN( gaspi_segment_ptr (buffer_receive.segment, &rcv_array) );
+    T *src_arr = (T *)((char*)src_array + buffer_send.offset);
+    T *rcv_arr = (T *)((char*)rcv_array + buffer_receive.offset);
+
+    // the partial result is accumulated in the request, since the
+    // children write their data to the receive buffer
+    request.tmp.resize(segment_size);
+    void *tmp_arr = request.tmp.data();
+
+    // Copy the data to the output buffer to avoid modifying the input buffer
+    if (children.empty())
+        request_copy(request, segment_size, src_arr, rcv_arr);
+    else
+        request_copy(request, segment_size, src_arr, tmp_arr);
+
+    // receive the data of the children one after the other, since all of them
+    // write to the receive buffer. The ones with the smallest subtrees are ready first
+    for (std::size_t c = 0; c < children.size(); c++) {
+        // need to send notification that the parent is ready to receive the data
+        request_notify(request, comm, buffer_send.segment, (children[c] + root) % nProc, ready, vrank + 1);
+
+        // receive data
+        request_wait(request, comm, buffer_receive.segment, window_receive + levels[c], vrank + 1);
+
+        // local reduce
+        request_reduce(request, num_elem, rcv_arr, tmp_arr);
+
+        // ackowledge child that the data has arrived
+        request_notify(request, comm, buffer_send.segment, (children[c] + root) % nProc, ack, vrank + 1);
+    }
+
+    // copy results to the receive buffer
+    if (!children.empty())
+        request_copy(request, segment_size, tmp_arr, rcv_arr);
+
+    if (vrank != 0) {
+        // wait for notification that the data can be sent
+        request_wait(request, comm, buffer_send.segment, ready, parent + 1);
+
+        // write the data to the parent
+        request_write(request, comm, buffer_receive.segment, buffer_receive.offset, (parent + root) % nProc
+                , buffer_receive.segment, buffer_receive.offset, segment_size
+                , window_receive + first_level - 1, parent + 1 // +1 so that the value is not zero
+        );
+
+        // wait for acknowledgement notification
+        request_wait(request, comm, buffer_send.segment, ack, parent + 1);
+    }
+
+    request_flush(request);
+
+    return GASPI_SUCCESS;
+}
+
+/** Nonblocking reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which is advanced by gaspi_request_test/gaspi_request_wait
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ireduce (const segmentBuffer buffer_send,
+               segmentBuffer buffer_receive,
+               const gaspi_number_t elem_cnt,
+               const Operation & op,
+               const gaspi_number_t root,
+               const gaspi_queue_id_t queue_id,
+               collRequest & request,
+               const collComm & comm)
+{
+    return gaspi_ireduce<T>(buffer_send, buffer_receive, elem_cnt, op, 1.0, root, queue_id, request, comm);
+}
+
+/** Weakly consistent nonblocking reduce collective operation that implements binomial tree
+ *
+ * @param buffer_send Segment with offset of the original data
+ * @param buffer_receive Segment with offset of the reduced data
+ * @param elem_cnt The number of data elements in the buffer
+ * @param operation The type of operations (MIN, MAX, SUM)
+ * @param threshold The threshold for the amount of data to be reduced. The value is in [0, 1]
+ * @param root The process id of the root
+ * @param queue_id The queue id
+ * @param request The request which is advanced by gaspi_request_test/gaspi_request_wait
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+template <typename T> gaspi_return_t 
+gaspi_ireduce (const segmentBuffer buffer_send,
+               segmentBuffer buffer_receive,
+               const gaspi_number_t elem_cnt,
+               const Operation & op,
+               const gaspi_double threshold,
+               const gaspi_number_t root,
+               const gaspi_queue_id_t queue_id,
+               collRequest & request,
+               const collComm & comm)
+{
+    SUCCESS_OR_RETURN( gaspi_reduce_init<T>(buffer_send, buffer_receive, elem_cnt, op, threshold, root, queue_id, request, comm) );
+
+    return gaspi_request_start(request);
+}
+
+// explicit template instantiation
+// consistent bcast
+template gaspi_return_t 
+gaspi_bcast<double> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast<float> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast<int> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast<unsigned int> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+// weakly consistent bcast
+template gaspi_return_t 
+gaspi_bcast<double> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast<float> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast<int> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast<unsigned int> (segmentBuffer buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+// consistent pipelined bcast
+template gaspi_return_t 
+gaspi_bcast_pipelined<double> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_pipelined<float> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_pipelined<int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_pipelined<unsigned int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+// weakly consistent pipelined bcast
+template gaspi_return_t 
+gaspi_bcast_pipelined<double> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_pipelined<float> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_pipelined<int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_pipelined<unsigned int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t chunk_elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
+
+// rotating window bcast, simple bcast and reduce
+template gaspi_return_t 
+gaspi_bcast_window<double> (segmentBuffer const buffer,
+                           const gaspi_number_t elem_cnt,
+                           const gaspi_double threshold,
+                           const gaspi_number_t iteration,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_window<float> (segmentBuffer const buffer,
+                          const gaspi_number_t elem_cnt,
+                          const gaspi_double threshold,
+                          const gaspi_number_t iteration,
+                          const gaspi_number_t root,
+                          const gaspi_queue_id_t queue_id,
+                          const gaspi_timeout_t timeout,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_window<int> (segmentBuffer const buffer,
+                        const gaspi_number_t elem_cnt,
+                        const gaspi_double threshold,
+                        const gaspi_number_t iteration,
+                        const gaspi_number_t root,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout,
+                        const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_window<unsigned int> (segmentBuffer const buffer,
+                                 const gaspi_number_t elem_cnt,
+                                 const gaspi_double threshold,
+                                 const gaspi_number_t iteration,
+                                 const gaspi_number_t root,
+                                 const gaspi_queue_id_t queue_id,
+                                 const gaspi_timeout_t timeout,
+                                 const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_window<double> (segmentBuffer const buffer,
+                                  const gaspi_number_t elem_cnt,
+                                  const gaspi_double threshold,
+                                  const gaspi_number_t iteration,
+                                  const gaspi_number_t root,
+                                  const gaspi_queue_id_t queue_id,
+                                  const gaspi_timeout_t timeout,
+                                  const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_window<float> (segmentBuffer const buffer,
+                                 const gaspi_number_t elem_cnt,
+                                 const gaspi_double threshold,
+                                 const gaspi_number_t iteration,
+                                 const gaspi_number_t root,
+                                 const gaspi_queue_id_t queue_id,
+                                 const gaspi_timeout_t timeout,
+                                 const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_window<int> (segmentBuffer const buffer,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_double threshold,
+                               const gaspi_number_t iteration,
+                               const gaspi_number_t root,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_window<unsigned int> (segmentBuffer const buffer,
+                                        const gaspi_number_t elem_cnt,
+                                        const gaspi_double threshold,
+                                        const gaspi_number_t iteration,
+                                        const gaspi_number_t root,
+                                        const gaspi_queue_id_t queue_id,
+                                        const gaspi_timeout_t timeout,
+                                        const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window<double> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double threshold,
+                            const gaspi_number_t iteration,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window<float> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double threshold,
+                           const gaspi_number_t iteration,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window<int> (const segmentBuffer buffer_send,
+                         segmentBuffer buffer_receive,
+                         const gaspi_number_t elem_cnt,
+                         const Operation & op,
+                         const gaspi_double threshold,
+                         const gaspi_number_t iteration,
+                         const gaspi_number_t root,
+                         const gaspi_queue_id_t queue_id,
+                         const gaspi_timeout_t timeout,
+                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window<unsigned int> (const segmentBuffer buffer_send,
+                                  segmentBuffer buffer_receive,
+                                  const gaspi_number_t elem_cnt,
+                                  const Operation & op,
+                                  const gaspi_double threshold,
+                                  const gaspi_number_t iteration,
+                                  const gaspi_number_t root,
+                                  const gaspi_queue_id_t queue_id,
+                                  const gaspi_timeout_t timeout,
+                                  const collComm & comm);
+
+// time-budget pipelined bcast
+template gaspi_return_t 
+gaspi_bcast_budget<double> (segmentBuffer const buffer,
+                           const gaspi_number_t elem_cnt,
+                           const gaspi_number_t chunk_elem_cnt,
+                           const gaspi_timeout_t budget,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           gaspi_number_t & completed,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_budget<float> (segmentBuffer const buffer,
+                          const gaspi_number_t elem_cnt,
+                          const gaspi_number_t chunk_elem_cnt,
+                          const gaspi_timeout_t budget,
+                          const gaspi_number_t root,
+                          const gaspi_queue_id_t queue_id,
+                          const gaspi_timeout_t timeout,
+                          gaspi_number_t & completed,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_budget<int> (segmentBuffer const buffer,
+                        const gaspi_number_t elem_cnt,
+                        const gaspi_number_t chunk_elem_cnt,
+                        const gaspi_timeout_t budget,
+                        const gaspi_number_t root,
+                        const gaspi_queue_id_t queue_id,
+                        const gaspi_timeout_t timeout,
+                        gaspi_number_t & completed,
+                        const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_budget<unsigned int> (segmentBuffer const buffer,
+                                 const gaspi_number_t elem_cnt,
+                                 const gaspi_number_t chunk_elem_cnt,
+                                 const gaspi_timeout_t budget,
+                                 const gaspi_number_t root,
+                                 const gaspi_queue_id_t queue_id,
+                                 const gaspi_timeout_t timeout,
+                                 gaspi_number_t & completed,
+                                 const collComm & comm);
+
+// consistent scatter-allgather bcast
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<double> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-        } else if (bst.isactive && (pow2i > iProc) && ((iProc + pow2i) < nProc)) {
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<float> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-            // need to send notification that the parent is ready to receive the data
-            gaspi_rank_t rank = bst.children[children_count-1] * nProc + iProc;        
-            gaspi_notification_id_t id = rank;
-            notify_and_wait(buffer_send.segment
-                    , bst.children[children_count-1], id, rank
-                    , queue_id, timeout
-            );
-        
-            // receive data
-            gaspi_notification_t val;
-            waitsome_and_reset(buffer_receive.segment
-                , bst.children[0], nProc - bst.children[0]
-                , &id, &val
-            );
-            ASSERT(id >= bst.children[0]);
-            ASSERT(id <= bst.children[bst.children_count-1]);
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-            // local reduce
-            local_reduce<T>(op, num_elem, &rcv_arr[0], &tmp_arr[0]);
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<unsigned int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-            // ackowledge child that the data has arrived
-            gaspi_notification_id_t ack = iProc + 1;
-            notify_and_wait(buffer_send.segment
-                    , bst.children[children_count - 1], ack, iProc + 1
-                    , queue_id, timeout
-            );
+// weakly consistent scatter-allgather bcast
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<double> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-            children_count--;
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<float> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-            // copy results to the receive buffer
-            if (!children_count)
-                std::memcpy((void*) rcv_arr, (void*) tmp_arr, segment_size);
-        }
-    }
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-    return GASPI_SUCCESS;
-}
+template gaspi_return_t 
+gaspi_bcast_scatter_allgather<unsigned int> (segmentBuffer const buffer,
+             const gaspi_number_t elem_cnt,
+             const gaspi_double threshold,
+             const gaspi_number_t root,
+             const gaspi_queue_id_t queue_id,
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-// explicit template instantiation
-// consistent bcast
+// consistent k-nomial bcast
 template gaspi_return_t 
-gaspi_bcast<double> (segmentBuffer buffer,
+gaspi_bcast_knomial<double> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
-gaspi_bcast<float> (segmentBuffer buffer,
+gaspi_bcast_knomial<float> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
-gaspi_bcast<int> (segmentBuffer buffer,
+gaspi_bcast_knomial<int> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
-gaspi_bcast<unsigned int> (segmentBuffer buffer,
+gaspi_bcast_knomial<unsigned int> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
-// weakly consistent bcast
+// weakly consistent k-nomial bcast
 template gaspi_return_t 
-gaspi_bcast<double> (segmentBuffer buffer,
+gaspi_bcast_knomial<double> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_double threshold,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
-gaspi_bcast<float> (segmentBuffer buffer,
+gaspi_bcast_knomial<float> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_double threshold,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
-gaspi_bcast<int> (segmentBuffer buffer,
+gaspi_bcast_knomial<int> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_double threshold,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
-gaspi_bcast<unsigned int> (segmentBuffer buffer,
+gaspi_bcast_knomial<unsigned int> (segmentBuffer const buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_double threshold,
+             const gaspi_number_t radix,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 // weakly consistent bcast -- simple version
 template gaspi_return_t 
@@ -704,7 +3170,8 @@ gaspi_bcast_simple<double> (segmentBuffer buffer,
              const gaspi_double threshold,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
 gaspi_bcast_simple<float> (segmentBuffer buffer,
@@ -712,7 +3179,8 @@ gaspi_bcast_simple<float> (segmentBuffer buffer,
              const gaspi_double threshold,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
 gaspi_bcast_simple<int> (segmentBuffer buffer,
@@ -720,7 +3188,8 @@ gaspi_bcast_simple<int> (segmentBuffer buffer,
              const gaspi_double threshold,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
 gaspi_bcast_simple<unsigned int> (segmentBuffer buffer,
@@ -728,7 +3197,8 @@ gaspi_bcast_simple<unsigned int> (segmentBuffer buffer,
              const gaspi_double threshold,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 // consistent bcast -- simple version
 template gaspi_return_t 
@@ -736,28 +3206,32 @@ gaspi_bcast_simple<double> (segmentBuffer buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
 gaspi_bcast_simple<float> (segmentBuffer buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
 gaspi_bcast_simple<int> (segmentBuffer buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 template gaspi_return_t 
 gaspi_bcast_simple<unsigned int> (segmentBuffer buffer,
              const gaspi_number_t elem_cnt,
              const gaspi_number_t root,
              const gaspi_queue_id_t queue_id,
-             const gaspi_timeout_t timeout);
+             const gaspi_timeout_t timeout,
+             const collComm & comm);
 
 // weakly consistent reduce
 template gaspi_return_t 
@@ -768,7 +3242,8 @@ gaspi_reduce<double> (const segmentBuffer buffer_send,
               const gaspi_double threshold,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 template gaspi_return_t 
 gaspi_reduce<float> (const segmentBuffer buffer_send,
@@ -778,7 +3253,8 @@ gaspi_reduce<float> (const segmentBuffer buffer_send,
               const gaspi_double threshold,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 template gaspi_return_t 
 gaspi_reduce<int> (const segmentBuffer buffer_send,
@@ -788,7 +3264,8 @@ gaspi_reduce<int> (const segmentBuffer buffer_send,
               const gaspi_double threshold,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 template gaspi_return_t 
 gaspi_reduce<unsigned int> (const segmentBuffer buffer_send,
@@ -798,7 +3275,8 @@ gaspi_reduce<unsigned int> (const segmentBuffer buffer_send,
               const gaspi_double threshold,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 // consistent reduce
 template gaspi_return_t 
@@ -808,7 +3286,8 @@ gaspi_reduce<double> (const segmentBuffer buffer_send,
               const Operation & op,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 template gaspi_return_t 
 gaspi_reduce<float> (const segmentBuffer buffer_send,
@@ -817,7 +3296,8 @@ gaspi_reduce<float> (const segmentBuffer buffer_send,
               const Operation & op,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 template gaspi_return_t 
 gaspi_reduce<int> (const segmentBuffer buffer_send,
@@ -826,7 +3306,8 @@ gaspi_reduce<int> (const segmentBuffer buffer_send,
               const Operation & op,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
 
 template gaspi_return_t 
 gaspi_reduce<unsigned int> (const segmentBuffer buffer_send,
@@ -835,5 +3316,837 @@ gaspi_reduce<unsigned int> (const segmentBuffer buffer_send,
               const Operation & op,
 	          const gaspi_number_t root,
               const gaspi_queue_id_t queue_id,
-	          const gaspi_timeout_t timeout);
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+// weakly consistent k-nomial reduce
+template gaspi_return_t 
+gaspi_reduce_knomial<double> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_double threshold,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_knomial<float> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_double threshold,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_knomial<int> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_double threshold,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_knomial<unsigned int> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_double threshold,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+// consistent k-nomial reduce
+template gaspi_return_t 
+gaspi_reduce_knomial<double> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_knomial<float> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_knomial<int> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_knomial<unsigned int> (const segmentBuffer buffer_send,
+   	          segmentBuffer buffer_receive,
+   	          segmentBuffer buffer_tmp,
+	          const gaspi_number_t elem_cnt,
+              const Operation & op,
+              const gaspi_number_t radix,
+	          const gaspi_number_t root,
+              const gaspi_queue_id_t queue_id,
+	          const gaspi_timeout_t timeout,
+              const collComm & comm);
+
+// weakly consistent quorum reduce and allreduce
+template gaspi_return_t 
+gaspi_reduce_quorum<double> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            segmentBuffer buffer_tmp,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double threshold,
+                            const gaspi_double quorum,
+                            const gaspi_timeout_t deadline,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            std::vector<gaspi_rank_t> & included,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_quorum<float> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           segmentBuffer buffer_tmp,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double threshold,
+                           const gaspi_double quorum,
+                           const gaspi_timeout_t deadline,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           std::vector<gaspi_rank_t> & included,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_quorum<int> (const segmentBuffer buffer_send,
+                         segmentBuffer buffer_receive,
+                         segmentBuffer buffer_tmp,
+                         const gaspi_number_t elem_cnt,
+                         const Operation & op,
+                         const gaspi_double threshold,
+                         const gaspi_double quorum,
+                         const gaspi_timeout_t deadline,
+                         const gaspi_number_t root,
+                         const gaspi_queue_id_t queue_id,
+                         const gaspi_timeout_t timeout,
+                         std::vector<gaspi_rank_t> & included,
+                         const collComm & comm);
 
+template gaspi_return_t 
+gaspi_reduce_quorum<unsigned int> (const segmentBuffer buffer_send,
+                                  segmentBuffer buffer_receive,
+                                  segmentBuffer buffer_tmp,
+                                  const gaspi_number_t elem_cnt,
+                                  const Operation & op,
+                                  const gaspi_double threshold,
+                                  const gaspi_double quorum,
+                                  const gaspi_timeout_t deadline,
+                                  const gaspi_number_t root,
+                                  const gaspi_queue_id_t queue_id,
+                                  const gaspi_timeout_t timeout,
+                                  std::vector<gaspi_rank_t> & included,
+                                  const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<double> (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               segmentBuffer buffer_tmp,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_double threshold,
+                               const gaspi_double quorum,
+                               const gaspi_timeout_t deadline,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               std::vector<gaspi_rank_t> & included,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              segmentBuffer buffer_tmp,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double threshold,
+                              const gaspi_double quorum,
+                              const gaspi_timeout_t deadline,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              std::vector<gaspi_rank_t> & included,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<int> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            segmentBuffer buffer_tmp,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double threshold,
+                            const gaspi_double quorum,
+                            const gaspi_timeout_t deadline,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            std::vector<gaspi_rank_t> & included,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<unsigned int> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     segmentBuffer buffer_tmp,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_double threshold,
+                                     const gaspi_double quorum,
+                                     const gaspi_timeout_t deadline,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     std::vector<gaspi_rank_t> & included,
+                                     const collComm & comm);
+
+// consistent quorum reduce and allreduce
+template gaspi_return_t 
+gaspi_reduce_quorum<double> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            segmentBuffer buffer_tmp,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double quorum,
+                            const gaspi_timeout_t deadline,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            std::vector<gaspi_rank_t> & included,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_quorum<float> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           segmentBuffer buffer_tmp,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double quorum,
+                           const gaspi_timeout_t deadline,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           std::vector<gaspi_rank_t> & included,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_quorum<int> (const segmentBuffer buffer_send,
+                         segmentBuffer buffer_receive,
+                         segmentBuffer buffer_tmp,
+                         const gaspi_number_t elem_cnt,
+                         const Operation & op,
+                         const gaspi_double quorum,
+                         const gaspi_timeout_t deadline,
+                         const gaspi_number_t root,
+                         const gaspi_queue_id_t queue_id,
+                         const gaspi_timeout_t timeout,
+                         std::vector<gaspi_rank_t> & included,
+                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_quorum<unsigned int> (const segmentBuffer buffer_send,
+                                  segmentBuffer buffer_receive,
+                                  segmentBuffer buffer_tmp,
+                                  const gaspi_number_t elem_cnt,
+                                  const Operation & op,
+                                  const gaspi_double quorum,
+                                  const gaspi_timeout_t deadline,
+                                  const gaspi_number_t root,
+                                  const gaspi_queue_id_t queue_id,
+                                  const gaspi_timeout_t timeout,
+                                  std::vector<gaspi_rank_t> & included,
+                                  const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<double> (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               segmentBuffer buffer_tmp,
+                               const gaspi_number_t elem_cnt,
+                               const Operation & op,
+                               const gaspi_double quorum,
+                               const gaspi_timeout_t deadline,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               std::vector<gaspi_rank_t> & included,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              segmentBuffer buffer_tmp,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_double quorum,
+                              const gaspi_timeout_t deadline,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              std::vector<gaspi_rank_t> & included,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<int> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            segmentBuffer buffer_tmp,
+                            const gaspi_number_t elem_cnt,
+                            const Operation & op,
+                            const gaspi_double quorum,
+                            const gaspi_timeout_t deadline,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            std::vector<gaspi_rank_t> & included,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_allreduce_quorum<unsigned int> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     segmentBuffer buffer_tmp,
+                                     const gaspi_number_t elem_cnt,
+                                     const Operation & op,
+                                     const gaspi_double quorum,
+                                     const gaspi_timeout_t deadline,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     std::vector<gaspi_rank_t> & included,
+                                     const collComm & comm);
+
+// nonblocking bcast and reduce
+template gaspi_return_t 
+gaspi_ibcast<double> (segmentBuffer const buffer,
+                      const gaspi_number_t elem_cnt,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      collRequest & request,
+                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<float> (segmentBuffer const buffer,
+                     const gaspi_number_t elem_cnt,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     collRequest & request,
+                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<int> (segmentBuffer const buffer,
+                   const gaspi_number_t elem_cnt,
+                   const gaspi_number_t root,
+                   const gaspi_queue_id_t queue_id,
+                   collRequest & request,
+                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<unsigned int> (segmentBuffer const buffer,
+                            const gaspi_number_t elem_cnt,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            collRequest & request,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<double> (segmentBuffer const buffer,
+                      const gaspi_number_t elem_cnt,
+                      const gaspi_double threshold,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      collRequest & request,
+                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<float> (segmentBuffer const buffer,
+                     const gaspi_number_t elem_cnt,
+                     const gaspi_double threshold,
+                     const gaspi_number_t root,
+                     const gaspi_queue_id_t queue_id,
+                     collRequest & request,
+                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<int> (segmentBuffer const buffer,
+                   const gaspi_number_t elem_cnt,
+                   const gaspi_double threshold,
+                   const gaspi_number_t root,
+                   const gaspi_queue_id_t queue_id,
+                   collRequest & request,
+                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ibcast<unsigned int> (segmentBuffer const buffer,
+                            const gaspi_number_t elem_cnt,
+                            const gaspi_double threshold,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            collRequest & request,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<double> (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       collRequest & request,
+                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<float> (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      collRequest & request,
+                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<int> (const segmentBuffer buffer_send,
+                    segmentBuffer buffer_receive,
+                    const gaspi_number_t elem_cnt,
+                    const Operation & op,
+                    const gaspi_number_t root,
+                    const gaspi_queue_id_t queue_id,
+                    collRequest & request,
+                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<unsigned int> (const segmentBuffer buffer_send,
+                             segmentBuffer buffer_receive,
+                             const gaspi_number_t elem_cnt,
+                             const Operation & op,
+                             const gaspi_number_t root,
+                             const gaspi_queue_id_t queue_id,
+                             collRequest & request,
+                             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<double> (const segmentBuffer buffer_send,
+                       segmentBuffer buffer_receive,
+                       const gaspi_number_t elem_cnt,
+                       const Operation & op,
+                       const gaspi_double threshold,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       collRequest & request,
+                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<float> (const segmentBuffer buffer_send,
+                      segmentBuffer buffer_receive,
+                      const gaspi_number_t elem_cnt,
+                      const Operation & op,
+                      const gaspi_double threshold,
+                      const gaspi_number_t root,
+                      const gaspi_queue_id_t queue_id,
+                      collRequest & request,
+                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<int> (const segmentBuffer buffer_send,
+                    segmentBuffer buffer_receive,
+                    const gaspi_number_t elem_cnt,
+                    const Operation & op,
+                    const gaspi_double threshold,
+                    const gaspi_number_t root,
+                    const gaspi_queue_id_t queue_id,
+                    collRequest & request,
+                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_ireduce<unsigned int> (const segmentBuffer buffer_send,
+                             segmentBuffer buffer_receive,
+                             const gaspi_number_t elem_cnt,
+                             const Operation & op,
+                             const gaspi_double threshold,
+                             const gaspi_number_t root,
+                             const gaspi_queue_id_t queue_id,
+                             collRequest & request,
+                             const collComm & comm);
+
+// persistent bcast and reduce
+template gaspi_return_t 
+gaspi_bcast_init<double> (segmentBuffer const buffer,
+                          const gaspi_number_t elem_cnt,
+                          const gaspi_number_t root,
+                          const gaspi_queue_id_t queue_id,
+                          collRequest & request,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<float> (segmentBuffer const buffer,
+                         const gaspi_number_t elem_cnt,
+                         const gaspi_number_t root,
+                         const gaspi_queue_id_t queue_id,
+                         collRequest & request,
+                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<int> (segmentBuffer const buffer,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       collRequest & request,
+                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<unsigned int> (segmentBuffer const buffer,
+                                const gaspi_number_t elem_cnt,
+                                const gaspi_number_t root,
+                                const gaspi_queue_id_t queue_id,
+                                collRequest & request,
+                                const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<double> (segmentBuffer const buffer,
+                          const gaspi_number_t elem_cnt,
+                          const gaspi_double threshold,
+                          const gaspi_number_t root,
+                          const gaspi_queue_id_t queue_id,
+                          collRequest & request,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<float> (segmentBuffer const buffer,
+                         const gaspi_number_t elem_cnt,
+                         const gaspi_double threshold,
+                         const gaspi_number_t root,
+                         const gaspi_queue_id_t queue_id,
+                         collRequest & request,
+                         const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<int> (segmentBuffer const buffer,
+                       const gaspi_number_t elem_cnt,
+                       const gaspi_double threshold,
+                       const gaspi_number_t root,
+                       const gaspi_queue_id_t queue_id,
+                       collRequest & request,
+                       const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_init<unsigned int> (segmentBuffer const buffer,
+                                const gaspi_number_t elem_cnt,
+                                const gaspi_double threshold,
+                                const gaspi_number_t root,
+                                const gaspi_queue_id_t queue_id,
+                                collRequest & request,
+                                const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<double> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           collRequest & request,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<float> (const segmentBuffer buffer_send,
+                          segmentBuffer buffer_receive,
+                          const gaspi_number_t elem_cnt,
+                          const Operation & op,
+                          const gaspi_number_t root,
+                          const gaspi_queue_id_t queue_id,
+                          collRequest & request,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<int> (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_number_t root,
+                        const gaspi_queue_id_t queue_id,
+                        collRequest & request,
+                        const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<unsigned int> (const segmentBuffer buffer_send,
+                                 segmentBuffer buffer_receive,
+                                 const gaspi_number_t elem_cnt,
+                                 const Operation & op,
+                                 const gaspi_number_t root,
+                                 const gaspi_queue_id_t queue_id,
+                                 collRequest & request,
+                                 const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<double> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_double threshold,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           collRequest & request,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<float> (const segmentBuffer buffer_send,
+                          segmentBuffer buffer_receive,
+                          const gaspi_number_t elem_cnt,
+                          const Operation & op,
+                          const gaspi_double threshold,
+                          const gaspi_number_t root,
+                          const gaspi_queue_id_t queue_id,
+                          collRequest & request,
+                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<int> (const segmentBuffer buffer_send,
+                        segmentBuffer buffer_receive,
+                        const gaspi_number_t elem_cnt,
+                        const Operation & op,
+                        const gaspi_double threshold,
+                        const gaspi_number_t root,
+                        const gaspi_queue_id_t queue_id,
+                        collRequest & request,
+                        const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_init<unsigned int> (const segmentBuffer buffer_send,
+                                 segmentBuffer buffer_receive,
+                                 const gaspi_number_t elem_cnt,
+                                 const Operation & op,
+                                 const gaspi_double threshold,
+                                 const gaspi_number_t root,
+                                 const gaspi_queue_id_t queue_id,
+                                 collRequest & request,
+                                 const collComm & comm);
+
+// reduce with error feedback, of the leading elements and of a rotating window
+template gaspi_return_t 
+gaspi_reduce_feedback<double> (const segmentBuffer buffer_send,
+                               segmentBuffer buffer_receive,
+                               segmentBuffer buffer_residual,
+                               const gaspi_number_t elem_cnt,
+                               const gaspi_double threshold,
+                               const gaspi_number_t root,
+                               const gaspi_queue_id_t queue_id,
+                               const gaspi_timeout_t timeout,
+                               const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_feedback<float> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              segmentBuffer buffer_residual,
+                              const gaspi_number_t elem_cnt,
+                              const gaspi_double threshold,
+                              const gaspi_number_t root,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_feedback<int> (const segmentBuffer buffer_send,
+                            segmentBuffer buffer_receive,
+                            segmentBuffer buffer_residual,
+                            const gaspi_number_t elem_cnt,
+                            const gaspi_double threshold,
+                            const gaspi_number_t root,
+                            const gaspi_queue_id_t queue_id,
+                            const gaspi_timeout_t timeout,
+                            const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_feedback<unsigned int> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     segmentBuffer buffer_residual,
+                                     const gaspi_number_t elem_cnt,
+                                     const gaspi_double threshold,
+                                     const gaspi_number_t root,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window_feedback<double> (const segmentBuffer buffer_send,
+                                      segmentBuffer buffer_receive,
+                                      segmentBuffer buffer_residual,
+                                      const gaspi_number_t elem_cnt,
+                                      const gaspi_double threshold,
+                                      const gaspi_number_t iteration,
+                                      const gaspi_number_t root,
+                                      const gaspi_queue_id_t queue_id,
+                                      const gaspi_timeout_t timeout,
+                                      const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window_feedback<float> (const segmentBuffer buffer_send,
+                                     segmentBuffer buffer_receive,
+                                     segmentBuffer buffer_residual,
+                                     const gaspi_number_t elem_cnt,
+                                     const gaspi_double threshold,
+                                     const gaspi_number_t iteration,
+                                     const gaspi_number_t root,
+                                     const gaspi_queue_id_t queue_id,
+                                     const gaspi_timeout_t timeout,
+                                     const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window_feedback<int> (const segmentBuffer buffer_send,
+                                   segmentBuffer buffer_receive,
+                                   segmentBuffer buffer_residual,
+                                   const gaspi_number_t elem_cnt,
+                                   const gaspi_double threshold,
+                                   const gaspi_number_t iteration,
+                                   const gaspi_number_t root,
+                                   const gaspi_queue_id_t queue_id,
+                                   const gaspi_timeout_t timeout,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_window_feedback<unsigned int> (const segmentBuffer buffer_send,
+                                            segmentBuffer buffer_receive,
+                                            segmentBuffer buffer_residual,
+                                            const gaspi_number_t elem_cnt,
+                                            const gaspi_double threshold,
+                                            const gaspi_number_t iteration,
+                                            const gaspi_number_t root,
+                                            const gaspi_queue_id_t queue_id,
+                                            const gaspi_timeout_t timeout,
+                                            const collComm & comm);
+
+// sampled simple bcast and reduce
+template gaspi_return_t 
+gaspi_bcast_simple_sampled<double> (segmentBuffer const buffer,
+                                    const gaspi_number_t elem_cnt,
+                                    const gaspi_number_t block_elem_cnt,
+                                    const gaspi_double threshold,
+                                    const gaspi_number_t seed,
+                                    const gaspi_number_t iteration,
+                                    const gaspi_number_t root,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_sampled<float> (segmentBuffer const buffer,
+                                   const gaspi_number_t elem_cnt,
+                                   const gaspi_number_t block_elem_cnt,
+                                   const gaspi_double threshold,
+                                   const gaspi_number_t seed,
+                                   const gaspi_number_t iteration,
+                                   const gaspi_number_t root,
+                                   const gaspi_queue_id_t queue_id,
+                                   const gaspi_timeout_t timeout,
+                                   const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_sampled<int> (segmentBuffer const buffer,
+                                 const gaspi_number_t elem_cnt,
+                                 const gaspi_number_t block_elem_cnt,
+                                 const gaspi_double threshold,
+                                 const gaspi_number_t seed,
+                                 const gaspi_number_t iteration,
+                                 const gaspi_number_t root,
+                                 const gaspi_queue_id_t queue_id,
+                                 const gaspi_timeout_t timeout,
+                                 const collComm & comm);
+
+template gaspi_return_t 
+gaspi_bcast_simple_sampled<unsigned int> (segmentBuffer const buffer,
+                                          const gaspi_number_t elem_cnt,
+                                          const gaspi_number_t block_elem_cnt,
+                                          const gaspi_double threshold,
+                                          const gaspi_number_t seed,
+                                          const gaspi_number_t iteration,
+                                          const gaspi_number_t root,
+                                          const gaspi_queue_id_t queue_id,
+                                          const gaspi_timeout_t timeout,
+                                          const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_sampled<double> (const segmentBuffer buffer_send,
+                              segmentBuffer buffer_receive,
+                              const gaspi_number_t elem_cnt,
+                              const Operation & op,
+                              const gaspi_number_t block_elem_cnt,
+                              const gaspi_double threshold,
+                              const gaspi_number_t seed,
+                              const gaspi_number_t iteration,
+                              const gaspi_number_t root,
+                              const gaspi_queue_id_t queue_id,
+                              const gaspi_timeout_t timeout,
+                              const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_sampled<float> (const segmentBuffer buffer_send,
+                             segmentBuffer buffer_receive,
+                             const gaspi_number_t elem_cnt,
+                             const Operation & op,
+                             const gaspi_number_t block_elem_cnt,
+                             const gaspi_double threshold,
+                             const gaspi_number_t seed,
+                             const gaspi_number_t iteration,
+                             const gaspi_number_t root,
+                             const gaspi_queue_id_t queue_id,
+                             const gaspi_timeout_t timeout,
+                             const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_sampled<int> (const segmentBuffer buffer_send,
+                           segmentBuffer buffer_receive,
+                           const gaspi_number_t elem_cnt,
+                           const Operation & op,
+                           const gaspi_number_t block_elem_cnt,
+                           const gaspi_double threshold,
+                           const gaspi_number_t seed,
+                           const gaspi_number_t iteration,
+                           const gaspi_number_t root,
+                           const gaspi_queue_id_t queue_id,
+                           const gaspi_timeout_t timeout,
+                           const collComm & comm);
+
+template gaspi_return_t 
+gaspi_reduce_sampled<unsigned int> (const segmentBuffer buffer_send,
+                                    segmentBuffer buffer_receive,
+                                    const gaspi_number_t elem_cnt,
+                                    const Operation & op,
+                                    const gaspi_number_t block_elem_cnt,
+                                    const gaspi_double threshold,
+                                    const gaspi_number_t seed,
+                                    const gaspi_number_t iteration,
+                                    const gaspi_number_t root,
+                                    const gaspi_queue_id_t queue_id,
+                                    const gaspi_timeout_t timeout,
+                                    const collComm & comm);
@@ -0,0 +1,309 @@
+#include "communicator.h"
+
+#include <DataStructsAndOps.hxx>
+#include "assert.h"
+#include "success_or_die.h"
+#include "success_or_return.h"
+#include "node.h"
+
+// The collectives pass the ranks and the notification ids relative to their
+// communicator, the following helpers translate them for GASPI. They return
+// the error of GASPI instead of exiting, and GASPI_TIMEOUT if the timeout of
+// the collective expires while they wait
+
+/** Number of stripes of a write
+ *
+ * @param comm The communicator
+ * @param size The number of bytes of the write
+ *
+ * @return The number of queues of the write, 1 if it is not striped
+ */
+gaspi_number_t
+comm_stripes ( collComm const & comm
+             , gaspi_size_t const size
+             )
+{
+    if ((comm.stripe_queues <= 1) || (comm.stripe_size == 0))
+        return 1;
+
+    gaspi_size_t const stripes = size / comm.stripe_size;
+    return MAX(MIN(stripes, comm.stripe_queues), 1);
+}
+
+gaspi_return_t
+notify_and_wait ( collComm const & comm
+                , gaspi_segment_id_t const segment_id_remote
+                , gaspi_rank_t const rank
+                , gaspi_notification_id_t const notification_id
+                , gaspi_notification_t const notification_value
+                , gaspi_queue_id_t const queue
+                , gaspi_timeout_t const timeout
+                )
+{
+    if (notification_id >= comm.notification_range)
+        return GASPI_ERROR;
+
+    gaspi_return_t ret;
+
+    /* notify, wait if required and re-submit */
+    while ((ret = gaspi_notify(segment_id_remote, comm.ranks[rank]
+                              , comm.notification_offset + notification_id, notification_value
+                              , queue, timeout)) == GASPI_QUEUE_FULL)
+        SUCCESS_OR_RETURN( gaspi_wait(queue, timeout) );
+
+    return ret;
+}
+
+gaspi_return_t
+write_and_wait ( collComm const & comm
+               , gaspi_segment_id_t const segment_id_local
+               , gaspi_offset_t const offset_local
+               , gaspi_rank_t const rank
+               , gaspi_segment_id_t const segment_id_remote
+               , gaspi_offset_t const offset_remote
+               , gaspi_size_t const size
+               , gaspi_queue_id_t const queue
+               , gaspi_timeout_t const timeout
+               )
+{
+    gaspi_return_t ret;
+
+    /* write, wait if required and re-submit */
+    while ((ret = gaspi_write(segment_id_local, offset_local, comm.ranks[rank]
+                             , segment_id_remote, offset_remote, size
+                             , queue, timeout)) == GASPI_QUEUE_FULL)
+        SUCCESS_OR_RETURN( gaspi_wait(queue, timeout) );
+
+    return ret;
+}
+
+gaspi_return_t
+write_notify_and_wait ( collComm const & comm
+                      , gaspi_segment_id_t const segment_id_local
+                      , gaspi_offset_t const offset_local
+                      , gaspi_rank_t const rank
+                      , gaspi_segment_id_t const segment_id_remote
+                      , gaspi_offset_t const offset_remote
+                      , gaspi_size_t const size
+                      , gaspi_notification_id_t const notification_id
+                      , gaspi_notification_t const notification_value
+                      , gaspi_queue_id_t const queue
+                      , gaspi_timeout_t const timeout
+                      )
+{
+    if (notification_id >= comm.notification_range)
+        return GASPI_ERROR;
+
+    gaspi_number_t const stripes = comm_stripes(comm, size);
+    if (stripes <= 1) {
+        gaspi_return_t ret;
+
+        /* write, wait if required and re-submit */
+        while ((ret = gaspi_write_notify(segment_id_local, offset_local, comm.ranks[rank]
+                                        , segment_id_remote, offset_remote, size
+                                        , comm.notification_offset + notification_id, notification_value
+                                        , queue, timeout)) == GASPI_QUEUE_FULL)
+            SUCCESS_OR_RETURN( gaspi_wait(queue, timeout) );
+
+        return ret;
+    }
+
+    // stripe s is written on the s-th queue after queue, the notification
+    // follows the first stripe on queue once the other queues have completed
+    gaspi_number_t queue_num;
+    SUCCESS_OR_RETURN( gaspi_queue_num(&queue_num) );
+
+    for (gaspi_number_t s = 0; s < stripes; s++) {
+        gaspi_size_t const stripe_start = (size * s) / stripes;
+        gaspi_size_t const stripe_end = (size * (s + 1)) / stripes;
+        SUCCESS_OR_RETURN( write_and_wait(comm, segment_id_local, offset_local + stripe_start, rank
+                                         , segment_id_remote, offset_remote + stripe_start, stripe_end - stripe_start
+                                         , (queue + s) % queue_num, timeout) );
+    }
+    for (gaspi_number_t s = 1; s < stripes; s++)
+        SUCCESS_OR_RETURN( gaspi_wait((queue + s) % queue_num, timeout) );
+
+    return notify_and_wait(comm, segment_id_remote, rank, notification_id, notification_value
+                          , queue, timeout);
+}
+
+gaspi_return_t
+wait_and_reset ( collComm const & comm
+               , gaspi_segment_id_t const segment_id
+               , gaspi_notification_id_t const notification_id
+               , gaspi_notification_t * value
+               , gaspi_timeout_t const timeout
+               )
+{
+    if (notification_id >= comm.notification_range)
+        return GASPI_ERROR;
+
+    gaspi_notification_id_t const id = comm.notification_offset + notification_id;
+    gaspi_notification_id_t first;
+    SUCCESS_OR_RETURN( gaspi_notify_waitsome(segment_id, id, 1, &first, timeout) );
+    if (first != id)
+        return GASPI_ERROR;
+
+    return gaspi_notify_reset(segment_id, id, value);
+}
+
+gaspi_return_t
+wait_or_timeout ( collComm const & comm
+                , gaspi_segment_id_t const segment_id
+                , gaspi_notification_id_t const notification_id
+                , gaspi_notification_t const expected
+                , gaspi_timeout_t const timeout
+                )
+{
+    gaspi_notification_t value;
+    SUCCESS_OR_RETURN( wait_and_reset(comm, segment_id, notification_id, &value, timeout) );
+
+    return (value == expected) ? GASPI_SUCCESS : GASPI_ERROR;
+}
+
+/** Communicator of all processes
+ *
+ * It is created on the first call, which is collective over GASPI_GROUP_ALL.
+ * It uses all notification ids and the workspace segment with the last
+ * segment id.
+ *
+ * @return The communicator of all processes
+ */
+collComm &
+gaspi_comm_world ()
+{
+    static collComm world;
+    static bool created = false;
+
+    if (!created) {
+        gaspi_rank_t iProc, nProc;
+        SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+        SUCCESS_OR_DIE( gaspi_proc_num(&nProc) );
+        gaspi_number_t notification_num, segment_max;
+        SUCCESS_OR_DIE( gaspi_notification_num(&notification_num) );
+        SUCCESS_OR_DIE( gaspi_segment_max(&segment_max) );
+
+        world.group = GASPI_GROUP_ALL;
+        world.ranks.clear();
+        for (gaspi_rank_t p = 0; p < nProc; p++)
+            world.ranks.push_back(p);
+        world.rank = iProc;
+        world.size = nProc;
+        world.notification_offset = 0;
+        world.notification_range = notification_num;
+        world.workspace = segment_max - 1;
+        world.stripe_queues = 1;
+        world.stripe_size = 0;
+
+        node_ranks(world, 0);
+        created = true;
+    }
+
+    return world;
+}
+
+/** Create a communicator of a subset of the processes
+ *
+ * The call is collective over the processes in ranks, which all have to pass
+ * the same arguments. The GASPI group of the members is committed and the
+ * members exchange their host names for the topology.
+ *
+ * @param ranks The GASPI ranks of the members, the rank in the communicator is the position in ranks
+ * @param num_ranks The number of members
+ * @param notification_offset The first notification id of the collectives
+ * @param notification_range The number of notification ids of the collectives
+ * @param workspace The id of the workspace segment, which is created by the collectives that need it
+ * @param timeout_ms Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ * @param comm The new communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout.
+ */
+gaspi_return_t
+gaspi_comm_create (const gaspi_rank_t *ranks,
+                   const gaspi_number_t num_ranks,
+                   const gaspi_notification_id_t notification_offset,
+                   const gaspi_number_t notification_range,
+                   const gaspi_segment_id_t workspace,
+                   const gaspi_timeout_t timeout_ms,
+                   collComm & comm)
+{
+    gaspi_rank_t iProc;
+    SUCCESS_OR_DIE( gaspi_proc_rank(&iProc) );
+    gaspi_number_t notification_num;
+    SUCCESS_OR_DIE( gaspi_notification_num(&notification_num) );
+    ASSERT (notification_offset + notification_range <= notification_num);
+
+    comm.ranks.assign(ranks, ranks + num_ranks);
+    comm.size = num_ranks;
+    comm.rank = num_ranks;
+    for (gaspi_rank_t p = 0; p < num_ranks; p++) {
+        if (ranks[p] == iProc)
+            comm.rank = p;
+    }
+    // only the members create the communicator
+    ASSERT (comm.rank < num_ranks);
+
+    comm.notification_offset = notification_offset;
+    comm.notification_range = notification_range;
+    comm.workspace = workspace;
+    comm.stripe_queues = 1;
+    comm.stripe_size = 0;
+
+    SUCCESS_OR_DIE( gaspi_group_create(&comm.group) );
+    for (gaspi_rank_t p = 0; p < num_ranks; p++)
+        SUCCESS_OR_DIE( gaspi_group_add(comm.group, ranks[p]) );
+
+    gaspi_return_t ret = gaspi_group_commit(comm.group, timeout_ms);
+    if (ret != GASPI_SUCCESS)
+        return ret;
+
+    node_ranks(comm, 0);
+
+    return GASPI_SUCCESS;
+}
+
+/** Delete a communicator which has been created by gaspi_comm_create
+ *
+ * @param comm The communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+gaspi_return_t
+gaspi_comm_delete (collComm & comm)
+{
+    SUCCESS_OR_DIE( gaspi_group_delete(comm.group) );
+
+    comm.ranks.clear();
+    comm.local_ranks.clear();
+    comm.leaders.clear();
+    comm.size = 0;
+
+    return GASPI_SUCCESS;
+}
+
+/** Stripe the large writes of the collectives across several queues
+ *
+ * @param comm The communicator
+ * @param num_queues The largest number of queues of a write
+ * @param stripe_size The smallest number of bytes of a stripe
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+gaspi_return_t
+gaspi_comm_striping (collComm & comm,
+                     const gaspi_number_t num_queues,
+                     const gaspi_size_t stripe_size)
+{
+    gaspi_number_t queue_num;
+    SUCCESS_OR_DIE( gaspi_queue_num(&queue_num) );
+    if ((num_queues < 1) || (num_queues > queue_num))
+        return GASPI_ERROR;
+
+    comm.stripe_queues = num_queues;
+    comm.stripe_size = stripe_size;
+
+    return GASPI_SUCCESS;
+}
@@ -0,0 +1,65 @@
+#ifndef COMMUNICATOR_ACTIONS_H
+#define COMMUNICATOR_ACTIONS_H
+
+#include <GASPI.h>
+
+#include <Communicator.hxx>
+
+gaspi_number_t
+comm_stripes ( collComm const & comm
+             , gaspi_size_t const size
+             );
+
+gaspi_return_t
+notify_and_wait ( collComm const & comm
+                , gaspi_segment_id_t const segment_id_remote
+                , gaspi_rank_t const rank
+                , gaspi_notification_id_t const notification_id
+                , gaspi_notification_t const notification_value
+                , gaspi_queue_id_t const queue
+                , gaspi_timeout_t const timeout
+                );
+
+gaspi_return_t
+write_and_wait ( collComm const & comm
+               , gaspi_segment_id_t const segment_id_local
+               , gaspi_offset_t const offset_local
+               , gaspi_rank_t const rank
+               , gaspi_segment_id_t const segment_id_remote
+               , gaspi_offset_t const offset_remote
+               , gaspi_size_t const size
+               , gaspi_queue_id_t const queue
+               , gaspi_timeout_t const timeout
+               );
+
+gaspi_return_t
+write_notify_and_wait ( collComm const & comm
+                      , gaspi_segment_id_t const segment_id_local
+                      , gaspi_offset_t const offset_local
+                      , gaspi_rank_t const rank
+                      , gaspi_segment_id_t const segment_id_remote
+                      , gaspi_offset_t const offset_remote
+                      , gaspi_size_t const size
+                      , gaspi_notification_id_t const notification_id
+                      , gaspi_notification_t const notification_value
+                      , gaspi_queue_id_t const queue
+                      , gaspi_timeout_t const timeout
+                      );
+
+gaspi_return_t
+wait_and_reset ( collComm const & comm
+               , gaspi_segment_id_t const segment_id
+               , gaspi_notification_id_t const notification_id
+               , gaspi_notification_t * value
+               , gaspi_timeout_t const timeout
+               );
+
+gaspi_return_t
+wait_or_timeout ( collComm const & comm
+                , gaspi_segment_id_t const segment_id
+                , gaspi_notification_id_t const notification_id
+                , gaspi_notification_t const expected
+                , gaspi_timeout_t const timeout
+                );
+
+#endif
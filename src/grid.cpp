@@ -0,0 +1,224 @@
+#include "grid.h"
+
+#include <cmath>
+
+#include "assert.h"
+#include "partition.h"
+
+/** Number of rows of the process grid
+ *
+ * @param nProc The number of processes
+ * @param rows The requested number of rows, which has to divide nProc, or 0
+ * for the divisor of nProc which is closest to sqrt(nProc) from below
+ *
+ * @return The number of rows
+ */
+gaspi_number_t
+grid_rows ( gaspi_rank_t const nProc
+          , gaspi_number_t const rows
+          )
+{
+    if (rows > 0) {
+        ASSERT (nProc % rows == 0);
+        return rows;
+    }
+
+    gaspi_number_t r = MAX((gaspi_number_t) sqrt(nProc), 1);
+    while (nProc % r != 0)
+        r--;
+
+    return r;
+}
+
+// the tree is used only if the number of processes is a power of two
+static bool
+use_tree ( int const n
+         , GridAlgorithm const algorithm
+         )
+{
+    return (algorithm == GRID_TREE) && ((n & (n - 1)) == 0);
+}
+
+// number of workspace elements of a reduce-scatter of cnt elements among n processes
+static unsigned int
+dimension_tmp ( int const n
+              , unsigned int const cnt
+              , GridAlgorithm const algorithm
+              )
+{
+    if (n <= 1)
+        return 0;
+
+    // every step of the tree receives in its own slot
+    if (use_tree(n, algorithm))
+        return log2(n) * cnt;
+
+    return cnt;
+}
+
+// appends the step which sends the chunks [send_first, send_last) and
+// receives the chunks [recv_first, recv_last)
+static void
+add_step ( std::vector<grid_step> & steps
+         , gaspi_rank_t const send_to
+         , gaspi_rank_t const recv_from
+         , std::vector<unsigned int> const & sizes
+         , std::vector<unsigned int> const & ends
+         , unsigned int const start
+         , int const send_first
+         , int const send_last
+         , int const recv_first
+         , int const recv_last
+         , unsigned int const tmp_base
+         , bool const reduce
+         )
+{
+    grid_step step;
+    step.send_to = send_to;
+    step.recv_from = recv_from;
+    step.send_start = start + ends[send_first] - sizes[send_first];
+    step.send_cnt = ends[send_last - 1] - (ends[send_first] - sizes[send_first]);
+    step.recv_start = start + ends[recv_first] - sizes[recv_first];
+    step.recv_cnt = ends[recv_last - 1] - (ends[recv_first] - sizes[recv_first]);
+    step.send_tmp = tmp_base + step.send_start - start;
+    step.recv_tmp = tmp_base + step.recv_start - start;
+    step.reduce = reduce;
+    steps.push_back(step);
+}
+
+/** Steps of a reduce-scatter or an allgather along one dimension of the grid
+ *
+ * The elements [start, start + cnt) are partitioned into one chunk per process
+ * of the group and the process at position pos owns chunk pos. The ring needs
+ * n - 1 steps, the tree uses recursive halving and doubling in log2(n) steps
+ * and is replaced by the ring if n is not a power of two.
+ *
+ * @param group The processes along the dimension
+ * @param pos The position of the calling process in the group
+ * @param start The first element
+ * @param cnt The number of elements
+ * @param algorithm Ring or tree
+ * @param reduce true for the reduce-scatter, false for the allgather
+ * @param tmp_base The first workspace element of the reduce-scatter
+ * @param steps The steps are appended
+ */
+static void
+dimension_steps ( std::vector<gaspi_rank_t> const & group
+                , int const pos
+                , unsigned int const start
+                , unsigned int const cnt
+                , GridAlgorithm const algorithm
+                , bool const reduce
+                , unsigned int const tmp_base
+                , std::vector<grid_step> & steps
+                )
+{
+    const int n = group.size();
+    if (n <= 1)
+        return;
+
+    std::vector<unsigned int> sizes, ends;
+    partition_chunks(cnt, n, sizes, ends);
+
+    if (!use_tree(n, algorithm)) {
+        const gaspi_rank_t send_to = group[(pos + 1) % n];
+        const gaspi_rank_t recv_from = group[(pos - 1 + n) % n];
+
+        // the reduce-scatter is shifted by one chunk with respect to
+        // gaspi_ring_allreduce, so that chunk pos is reduced last
+        const int shift = reduce ? 1 : 0;
+        for (int t = 0; t < n - 1; t++) {
+            int send_chunk = (pos - t - shift + 2 * n) % n;
+            int recv_chunk = (pos - t - shift - 1 + 2 * n) % n;
+            add_step(steps, send_to, recv_from, sizes, ends, start
+                    , send_chunk, send_chunk + 1, recv_chunk, recv_chunk + 1
+                    , tmp_base, reduce);
+        }
+        return;
+    }
+
+    if (reduce) {
+        // recursive halving: keep the half of the chunks which contains pos
+        int lo = 0;
+        int k = 0;
+        for (int mask = n / 2; mask >= 1; mask /= 2, k++) {
+            const gaspi_rank_t partner = group[pos ^ mask];
+            if (pos & mask) {
+                add_step(steps, partner, partner, sizes, ends, start
+                        , lo, lo + mask, lo + mask, lo + 2 * mask
+                        , tmp_base + k * cnt, true);
+                lo += mask;
+            } else {
+                add_step(steps, partner, partner, sizes, ends, start
+                        , lo + mask, lo + 2 * mask, lo, lo + mask
+                        , tmp_base + k * cnt, true);
+            }
+        }
+    } else {
+        // recursive doubling: exchange the chunks gathered so far
+        for (int mask = 1; mask < n; mask *= 2) {
+            const int partner = pos ^ mask;
+            const int mine = pos & ~(mask - 1);
+            const int theirs = partner & ~(mask - 1);
+            add_step(steps, group[partner], group[partner], sizes, ends, start
+                    , mine, mine + mask, theirs, theirs + mask
+                    , tmp_base, false);
+        }
+    }
+}
+
+/** Steps of the allreduce on a rows x (nProc / rows) process grid
+ *
+ * Process iProc is in row iProc / columns and column iProc % columns. The data
+ * is reduce-scattered along the rows, the chunk of every process is allreduced
+ * along the columns and the chunks are allgathered along the rows.
+ *
+ * @param iProc The rank of the process
+ * @param nProc The number of processes
+ * @param num_elem The number of elements to be reduced
+ * @param rows The number of rows (see grid_rows)
+ * @param row_algorithm The algorithm along the rows
+ * @param col_algorithm The algorithm along the columns
+ * @param steps The steps of the calling process
+ *
+ * @return The number of workspace elements, which is the same on all processes
+ */
+gaspi_number_t
+grid_allreduce_steps ( gaspi_rank_t const iProc
+                     , gaspi_rank_t const nProc
+                     , gaspi_number_t const num_elem
+                     , gaspi_number_t const rows
+                     , GridAlgorithm const row_algorithm
+                     , GridAlgorithm const col_algorithm
+                     , std::vector<grid_step> & steps
+                     )
+{
+    const int num_rows = grid_rows(nProc, rows);
+    const int num_cols = nProc / num_rows;
+    const int row = iProc / num_cols;
+    const int col = iProc % num_cols;
+
+    std::vector<gaspi_rank_t> row_group, col_group;
+    for (int j = 0; j < num_cols; j++)
+        row_group.push_back(row * num_cols + j);
+    for (int i = 0; i < num_rows; i++)
+        col_group.push_back(i * num_cols + col);
+
+    // the chunk of the process after the reduce-scatter along the row
+    std::vector<unsigned int> sizes, ends;
+    partition_chunks(num_elem, num_cols, sizes, ends);
+    const unsigned int chunk_start = ends[col] - sizes[col];
+    const unsigned int chunk_cnt = sizes[col];
+
+    // the columns receive behind the rows in the workspace
+    const unsigned int row_tmp = dimension_tmp(num_cols, num_elem, row_algorithm);
+
+    steps.clear();
+    dimension_steps(row_group, col, 0, num_elem, row_algorithm, true, 0, steps);
+    dimension_steps(col_group, row, chunk_start, chunk_cnt, col_algorithm, true, row_tmp, steps);
+    dimension_steps(col_group, row, chunk_start, chunk_cnt, col_algorithm, false, 0, steps);
+    dimension_steps(row_group, col, 0, num_elem, row_algorithm, false, 0, steps);
+
+    // the first chunk is the largest one
+    return row_tmp + dimension_tmp(num_rows, sizes[0], col_algorithm);
+}
@@ -0,0 +1,42 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include <vector>
+
+#include <GASPI.h>
+
+#include "DataStructsAndOps.hxx"
+
+// one step of a collective on a process grid. The elements
+// [send_start, send_start + send_cnt) are sent and the elements
+// [recv_start, recv_start + recv_cnt) are received. The steps which reduce
+// the received data receive it at recv_tmp in the workspace, the sender
+// writes it at send_tmp of the workspace of its peer
+struct grid_step {
+    gaspi_rank_t send_to;
+    gaspi_rank_t recv_from;
+    unsigned int send_start;
+    unsigned int send_cnt;
+    unsigned int recv_start;
+    unsigned int recv_cnt;
+    unsigned int send_tmp;
+    unsigned int recv_tmp;
+    bool reduce;
+};
+
+gaspi_number_t
+grid_rows ( gaspi_rank_t const nProc
+          , gaspi_number_t const rows
+          );
+
+gaspi_number_t
+grid_allreduce_steps ( gaspi_rank_t const iProc
+                     , gaspi_rank_t const nProc
+                     , gaspi_number_t const num_elem
+                     , gaspi_number_t const rows
+                     , GridAlgorithm const row_algorithm
+                     , GridAlgorithm const col_algorithm
+                     , std::vector<grid_step> & steps
+                     );
+
+#endif
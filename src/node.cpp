@@ -0,0 +1,86 @@
+#include "node.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unistd.h>
+
+#include "success_or_die.h"
+#include "communicator.h"
+#include "notification.h"
+#include "workspace.h"
+
+// number of characters of the host names which are compared
+#define NODE_NAME_LEN 64
+
+/** Co-located members of a communicator and node leaders
+ *
+ * The members exchange their host names through the workspace segment of the
+ * communicator, which is collective over its group. The topology is kept in
+ * the communicator. The leader of a node is its member with the lowest rank.
+ *
+ * @param comm The communicator, its local_ranks, leaders and max_local are set
+ * @param queue_id Queue id for the exchange of the host names
+ */
+void
+node_ranks ( collComm & comm
+           , gaspi_queue_id_t const queue_id
+           )
+{
+    gaspi_rank_t const iProc = comm.rank;
+    gaspi_rank_t const nProc = comm.size;
+
+    // slot p of the workspace receives the host name of member p
+    // with the notification p of the window
+    gaspi_pointer_t tmp_arr;
+    gaspi_segment_id_t tmp_segment;
+    SUCCESS_OR_DIE( workspace_segment(comm, nProc * NODE_NAME_LEN, GASPI_BLOCK, &tmp_segment, &tmp_arr) );
+    gaspi_notification_id_t window;
+    SUCCESS_OR_DIE( notification_window(comm, tmp_segment, nProc, &window) );
+    char *names = (char *) tmp_arr;
+
+    std::memset(&names[iProc * NODE_NAME_LEN], 0, NODE_NAME_LEN);
+    gethostname(&names[iProc * NODE_NAME_LEN], NODE_NAME_LEN - 1);
+
+    // the peers might still use the workspace in a previous collective
+    SUCCESS_OR_DIE( gaspi_barrier(comm.group, GASPI_BLOCK) );
+
+    for (gaspi_rank_t p = 0; p < nProc; p++) {
+        if (p != iProc) {
+            SUCCESS_OR_DIE( write_notify_and_wait(comm, tmp_segment, iProc * NODE_NAME_LEN
+                    , p, tmp_segment, iProc * NODE_NAME_LEN
+                    , NODE_NAME_LEN, window + iProc, iProc + 1
+                    , queue_id, GASPI_BLOCK
+            ) );
+        }
+    }
+
+    for (gaspi_rank_t p = 0; p < nProc; p++) {
+        if (p != iProc)
+            SUCCESS_OR_DIE( wait_or_timeout( comm, tmp_segment, window + p, p + 1, GASPI_BLOCK ) );
+    }
+    SUCCESS_OR_DIE( gaspi_wait(queue_id, GASPI_BLOCK) );
+
+    std::vector<std::string> node_names;
+    for (gaspi_rank_t p = 0; p < nProc; p++)
+        node_names.push_back(std::string(&names[p * NODE_NAME_LEN]));
+
+    // the workspace must not be reused before all names have been read
+    SUCCESS_OR_DIE( gaspi_barrier(comm.group, GASPI_BLOCK) );
+
+    // the members of a node in ascending order
+    std::map<std::string, std::vector<gaspi_rank_t> > nodes;
+    for (gaspi_rank_t p = 0; p < nProc; p++)
+        nodes[node_names[p]].push_back(p);
+
+    comm.leaders.clear();
+    comm.max_local = 0;
+    for (auto const & node : nodes) {
+        comm.leaders.push_back(node.second[0]);
+        if (node.second.size() > comm.max_local)
+            comm.max_local = node.second.size();
+    }
+    std::sort(comm.leaders.begin(), comm.leaders.end());
+    comm.local_ranks = nodes[node_names[iProc]];
+}
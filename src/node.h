@@ -0,0 +1,13 @@
+#ifndef NODE_H
+#define NODE_H
+
+#include <GASPI.h>
+
+#include <Communicator.hxx>
+
+void
+node_ranks ( collComm & comm
+           , gaspi_queue_id_t const queue_id
+           );
+
+#endif
@@ -0,0 +1,139 @@
+#include "notification.h"
+
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include <DataStructsAndOps.hxx>
+
+#include "assert.h"
+
+typedef std::pair<gaspi_group_t, gaspi_segment_id_t> windowKey;
+
+// first notification id of the next window of every group and segment
+static std::map<windowKey, gaspi_number_t> window_next;
+
+// windows of the persistent requests of every group and segment, i.e. the
+// size of the window by its first notification id
+static std::map<windowKey, std::map<gaspi_notification_id_t, gaspi_number_t> > window_reserved;
+
+/** Window of notification ids for one collective
+ *
+ * The windows of a segment are handed out round-robin from the notification
+ * range of the communicator, i.e. a window is reused once the range is
+ * exhausted. The windows which are reserved by persistent requests are
+ * skipped until the requests release them. All members have to request,
+ * reserve and release the same windows in the same order, which is the case
+ * as long as they call the same collectives and destroy their requests in the
+ * same order. Collectives which are in progress at the same time get disjoint
+ * windows, as long as they need less than the whole range together.
+ *
+ * @param comm The communicator
+ * @param segment_id The segment which receives the notifications
+ * @param size The number of notification ids
+ * @param window The first notification id of the window, relative to the communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR if the reserved
+ * windows leave no room for the window
+ */
+gaspi_return_t
+notification_window ( collComm const & comm
+                    , gaspi_segment_id_t const segment_id
+                    , gaspi_number_t const size
+                    , gaspi_notification_id_t * const window
+                    )
+{
+    if (size > comm.notification_range)
+        return GASPI_ERROR;
+
+    windowKey const key = std::make_pair(comm.group, segment_id);
+    std::map<gaspi_notification_id_t, gaspi_number_t> const & reserved = window_reserved[key];
+    gaspi_number_t & next = window_next[key];
+
+    gaspi_number_t first = next;
+    bool wrapped = false;
+    for (;;) {
+        if (first + size > comm.notification_range) {
+            if (wrapped)
+                return GASPI_ERROR;
+            first = 0;
+            wrapped = true;
+        }
+
+        // the reserved window which ends last before the end of the window
+        auto it = reserved.lower_bound(first + size);
+        if ((it == reserved.begin()) || (std::prev(it)->first + std::prev(it)->second <= first))
+            break;
+
+        // continue behind the reserved window
+        first = std::prev(it)->first + std::prev(it)->second;
+    }
+
+    *window = first;
+    next = first + size;
+
+    return GASPI_SUCCESS;
+}
+
+/** Size of the largest window which notification_window can hand out
+ *
+ * The collectives which adapt the number of their notifications to the
+ * notification range, e.g. the sub-blocks of the ring, use this size
+ * instead of the whole range, since the reserved windows are skipped.
+ *
+ * @param comm The communicator
+ * @param segment_id The segment which receives the notifications
+ *
+ * @return The largest number of consecutive notification ids which are not reserved
+ */
+gaspi_number_t
+notification_available ( collComm const & comm
+                       , gaspi_segment_id_t const segment_id
+                       )
+{
+    std::map<gaspi_notification_id_t, gaspi_number_t> const & reserved = window_reserved[std::make_pair(comm.group, segment_id)];
+
+    gaspi_number_t largest = 0;
+    gaspi_number_t first = 0;
+    for (auto const & window : reserved) {
+        largest = MAX(largest, (gaspi_number_t) window.first - first);
+        first = window.first + window.second;
+    }
+
+    return MAX(largest, comm.notification_range - first);
+}
+
+/** Reserve a window of notification ids for a persistent request
+ *
+ * @param group The group of the communicator
+ * @param segment_id The segment which receives the notifications
+ * @param window The first notification id of the window, relative to the communicator
+ * @param size The number of notification ids
+ */
+void
+notification_reserve ( gaspi_group_t const group
+                     , gaspi_segment_id_t const segment_id
+                     , gaspi_notification_id_t const window
+                     , gaspi_number_t const size
+                     )
+{
+    std::map<gaspi_notification_id_t, gaspi_number_t> & reserved = window_reserved[std::make_pair(group, segment_id)];
+    ASSERT (reserved.find(window) == reserved.end());
+
+    reserved[window] = size;
+}
+
+/** Release a window of notification ids of a persistent request
+ *
+ * @param group The group of the communicator
+ * @param segment_id The segment which receives the notifications
+ * @param window The first notification id of the window, relative to the communicator
+ */
+void
+notification_release ( gaspi_group_t const group
+                     , gaspi_segment_id_t const segment_id
+                     , gaspi_notification_id_t const window
+                     )
+{
+    window_reserved[std::make_pair(group, segment_id)].erase(window);
+}
@@ -0,0 +1,33 @@
+#ifndef NOTIFICATION_H
+#define NOTIFICATION_H
+
+#include <GASPI.h>
+
+#include <Communicator.hxx>
+
+gaspi_return_t
+notification_window ( collComm const & comm
+                    , gaspi_segment_id_t const segment_id
+                    , gaspi_number_t const size
+                    , gaspi_notification_id_t * const window
+                    );
+
+gaspi_number_t
+notification_available ( collComm const & comm
+                       , gaspi_segment_id_t const segment_id
+                       );
+
+void
+notification_reserve ( gaspi_group_t const group
+                     , gaspi_segment_id_t const segment_id
+                     , gaspi_notification_id_t const window
+                     , gaspi_number_t const size
+                     );
+
+void
+notification_release ( gaspi_group_t const group
+                     , gaspi_segment_id_t const segment_id
+                     , gaspi_notification_id_t const window
+                     );
+
+#endif
@@ -0,0 +1,124 @@
+#include "partition.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "assert.h"
+
+/** Partition elem_cnt elements into num_chunks contiguous chunks
+ *
+ * The first (elem_cnt % num_chunks) chunks get one element more than the others.
+ *
+ * @param elem_cnt The number of data elements
+ * @param num_chunks The number of chunks
+ * @param segment_sizes The number of data elements of every chunk
+ * @param segment_ends The index of the first element after every chunk
+ */
+void
+partition_chunks ( gaspi_number_t const elem_cnt
+                 , gaspi_number_t const num_chunks
+                 , std::vector<unsigned int> & segment_sizes
+                 , std::vector<unsigned int> & segment_ends
+                 )
+{
+    // Partition elements of array into num_chunks chunks
+    const unsigned int segment_size = elem_cnt / num_chunks;
+    segment_sizes.assign(num_chunks, segment_size);
+
+    const unsigned int segment_residual = elem_cnt % num_chunks;
+    for (unsigned int i = 0; i < segment_residual; i++) 
+        segment_sizes[i]++;
+
+    // Compute where each chunk ends
+    segment_ends.resize(num_chunks);
+    segment_ends[0] = segment_sizes[0];
+    for (unsigned int i = 1; i < num_chunks; i++) 
+        segment_ends[i] = segment_sizes[i] + segment_ends[i-1];
+   
+    // The last chunk should end at the end of the data
+    ASSERT (segment_ends[num_chunks - 1] == elem_cnt);
+}
+
+/** Window of the data of one call of a rotating eventually consistent collective
+ *
+ * The window has ceil(elem_cnt * threshold) elements and starts where the
+ * window of the previous call ended, wrapping around at the end of the data,
+ * so every element is in a window once every ceil(elem_cnt / window size)
+ * calls. A wrapping window consists of two contiguous parts.
+ *
+ * @param elem_cnt The number of data elements
+ * @param threshold The fraction of the data in a window. The value is in [0, 1]
+ * @param iteration The number of the call
+ * @param window_start The first element of the window
+ * @param first_cnt The number of elements of the window from window_start on
+ * @param second_cnt The number of elements of the window from 0 on, 0 if the window does not wrap
+ */
+void
+partition_window ( gaspi_number_t const elem_cnt
+                 , gaspi_double const threshold
+                 , gaspi_number_t const iteration
+                 , gaspi_number_t & window_start
+                 , gaspi_number_t & first_cnt
+                 , gaspi_number_t & second_cnt
+                 )
+{
+    gaspi_number_t const num_elem = ceil(elem_cnt * threshold);
+
+    window_start = 0;
+    first_cnt = num_elem;
+    second_cnt = 0;
+    if ((num_elem == 0) || (num_elem >= elem_cnt))
+        return;
+
+    window_start = ((unsigned long long) iteration * num_elem) % elem_cnt;
+    if (window_start + num_elem > elem_cnt) {
+        first_cnt = elem_cnt - window_start;
+        second_cnt = num_elem - first_cnt;
+    }
+}
+
+/** Pseudo-random blocks of the data of one call of a sampled collective
+ *
+ * The data is split into blocks of block_elem_cnt elements (the last one may
+ * be shorter), of which ceil(num_blocks * threshold) are drawn without
+ * replacement by a partial Fisher-Yates shuffle. The generator is seeded
+ * with seed and iteration only, so all processes draw the same blocks without
+ * any communication, and every block is equally likely to be drawn in a call.
+ *
+ * @param elem_cnt The number of data elements
+ * @param block_elem_cnt The number of data elements of a block
+ * @param threshold The fraction of the blocks which are drawn. The value is in [0, 1]
+ * @param seed The seed which is shared by all processes
+ * @param iteration The number of the call
+ * @param blocks The indices of the drawn blocks in ascending order
+ */
+void
+partition_blocks ( gaspi_number_t const elem_cnt
+                 , gaspi_number_t const block_elem_cnt
+                 , gaspi_double const threshold
+                 , gaspi_number_t const seed
+                 , gaspi_number_t const iteration
+                 , std::vector<gaspi_number_t> & blocks
+                 )
+{
+    gaspi_number_t const block_size = (block_elem_cnt > 0) ? block_elem_cnt : 1;
+    gaspi_number_t const num_blocks = (elem_cnt + block_size - 1) / block_size;
+    gaspi_number_t const num_drawn = ceil(num_blocks * threshold);
+
+    blocks.resize(num_blocks);
+    for (gaspi_number_t b = 0; b < num_blocks; b++)
+        blocks[b] = b;
+
+    // the output of mt19937 is fixed by the standard, unlike the one of the
+    // distributions, so the blocks are the same with every library
+    std::seed_seq seq {seed, iteration};
+    std::mt19937 generator(seq);
+    for (gaspi_number_t i = 0; (i < num_drawn) && (i + 1 < num_blocks); i++) {
+        gaspi_number_t const j = i + generator() % (num_blocks - i);
+        std::swap(blocks[i], blocks[j]);
+    }
+
+    blocks.resize(std::min(num_drawn, num_blocks));
+    std::sort(blocks.begin(), blocks.end());
+}
@@ -0,0 +1,33 @@
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include <vector>
+
+#include <GASPI.h>
+
+void
+partition_chunks ( gaspi_number_t const elem_cnt
+                 , gaspi_number_t const num_chunks
+                 , std::vector<unsigned int> & segment_sizes
+                 , std::vector<unsigned int> & segment_ends
+                 );
+
+void
+partition_window ( gaspi_number_t const elem_cnt
+                 , gaspi_double const threshold
+                 , gaspi_number_t const iteration
+                 , gaspi_number_t & window_start
+                 , gaspi_number_t & first_cnt
+                 , gaspi_number_t & second_cnt
+                 );
+
+void
+partition_blocks ( gaspi_number_t const elem_cnt
+                 , gaspi_number_t const block_elem_cnt
+                 , gaspi_double const threshold
+                 , gaspi_number_t const seed
+                 , gaspi_number_t const iteration
+                 , std::vector<gaspi_number_t> & blocks
+                 );
+
+#endif
@@ -0,0 +1,27 @@
+#include "quorum.h"
+
+#include <map>
+#include <utility>
+
+// state of every group and segment
+static std::map<std::pair<gaspi_group_t, gaspi_segment_id_t>, quorumState> states;
+
+/** State of the quorum collectives on a segment
+ *
+ * A process which misses the deadline of its parent writes its contribution
+ * after the parent has moved on. The calls are numbered, so that such a late
+ * contribution can be told apart from the one of the current call. All
+ * members have to call the quorum collectives on a segment in the same order.
+ *
+ * @param comm The communicator
+ * @param segment_id The segment which receives the contributions
+ *
+ * @return The state of the quorum collectives of the communicator on the segment
+ */
+quorumState &
+quorum_state ( collComm const & comm
+             , gaspi_segment_id_t const segment_id
+             )
+{
+    return states[std::make_pair(comm.group, segment_id)];
+}
@@ -0,0 +1,24 @@
+#ifndef QUORUM_H
+#define QUORUM_H
+
+#include <GASPI.h>
+
+#include <Communicator.hxx>
+
+// state of the quorum collectives on one segment which is kept between the
+// calls: the number of the current call, which is the notification value of
+// all its notifications, the value of the last ready notification of the
+// parent and the window of notification ids which is reserved for the calls
+struct quorumState {
+    gaspi_notification_t sequence = 0;
+    gaspi_notification_t ready = 0;
+    gaspi_notification_id_t window = 0;
+    bool reserved = false;
+};
+
+quorumState &
+quorum_state ( collComm const & comm
+             , gaspi_segment_id_t const segment_id
+             );
+
+#endif
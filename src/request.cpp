@@ -0,0 +1,366 @@
+#include "request.h"
+
+#include <chrono>
+#include <cstring>
+
+#include "assert.h"
+#include "success_or_die.h"
+#include "communicator.h"
+#include "notification.h"
+
+// releases the windows of notification ids of a request
+static void
+request_release ( collRequest & request )
+{
+    for (requestWindow const & window : request.windows)
+        notification_release(window.group, window.segment_id, window.first);
+    request.windows.clear();
+}
+
+collRequest::~collRequest()
+{
+    request_release(*this);
+}
+
+/** Reset a request for a new collective
+ *
+ * @param request The request
+ * @param queue_id The queue of the writes
+ * @param op The operation of the reductions
+ */
+void
+request_init ( collRequest & request
+             , gaspi_queue_id_t const queue_id
+             , Operation const op
+             )
+{
+    request.actions.clear();
+    request.next = 0;
+    request.queue_id = queue_id;
+    request.op = op;
+    request.reduce = NULL;
+    request.tmp.clear();
+    request_release(request);
+}
+
+/** Window of notification ids which the request keeps for its plan
+ *
+ * The window is taken as by notification_window, but it is reserved until
+ * the request is destroyed or planned again, so no other collective gets it
+ * while the plan can be started.
+ *
+ * @param request The request
+ * @param comm The communicator
+ * @param segment_id The segment which receives the notifications
+ * @param size The number of notification ids
+ * @param window The first notification id of the window, relative to the communicator
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR if there is no
+ * room for the window
+ */
+gaspi_return_t
+request_window ( collRequest & request
+               , collComm const & comm
+               , gaspi_segment_id_t const segment_id
+               , gaspi_number_t const size
+               , gaspi_notification_id_t * const window
+               )
+{
+    gaspi_return_t const ret = notification_window(comm, segment_id, size, window);
+    if (ret != GASPI_SUCCESS)
+        return ret;
+
+    notification_reserve(comm.group, segment_id, *window, size);
+    request.windows.push_back({comm.group, segment_id, *window});
+
+    return GASPI_SUCCESS;
+}
+
+// appends an action of the given type without any parameters
+static requestAction &
+request_append ( collRequest & request
+               , requestActionType const type
+               )
+{
+    requestAction action;
+    std::memset(&action, 0, sizeof(action));
+    action.type = type;
+    action.queue_id = request.queue_id;
+    request.actions.push_back(action);
+
+    return request.actions.back();
+}
+
+void
+request_wait ( collRequest & request
+             , collComm const & comm
+             , gaspi_segment_id_t const segment_id
+             , gaspi_notification_id_t const notification_id
+             , gaspi_notification_t const expected
+             )
+{
+    ASSERT (notification_id < comm.notification_range);
+
+    requestAction & action = request_append(request, ACTION_WAIT);
+    action.segment_local = segment_id;
+    action.notification_id = comm.notification_offset + notification_id;
+    action.notification_value = expected;
+}
+
+void
+request_write ( collRequest & request
+              , collComm const & comm
+              , gaspi_segment_id_t const segment_id_local
+              , gaspi_offset_t const offset_local
+              , gaspi_rank_t const rank
+              , gaspi_segment_id_t const segment_id_remote
+              , gaspi_offset_t const offset_remote
+              , gaspi_size_t const size
+              , gaspi_notification_id_t const notification_id
+              , gaspi_notification_t const notification_value
+              )
+{
+    ASSERT (notification_id < comm.notification_range);
+
+    // a striped write posts the stripes without notification on consecutive
+    // queues, flushes the other queues and notifies on the queue of the request
+    gaspi_number_t const stripes = comm_stripes(comm, size);
+    if (stripes > 1) {
+        gaspi_number_t queue_num;
+        SUCCESS_OR_DIE( gaspi_queue_num(&queue_num) );
+
+        for (gaspi_number_t s = 0; s < stripes; s++) {
+            gaspi_size_t const stripe_start = (size * s) / stripes;
+            gaspi_size_t const stripe_end = (size * (s + 1)) / stripes;
+
+            requestAction & action = request_append(request, ACTION_WRITE);
+            action.segment_local = segment_id_local;
+            action.offset_local = offset_local + stripe_start;
+            action.rank = comm.ranks[rank];
+            action.segment_remote = segment_id_remote;
+            action.offset_remote = offset_remote + stripe_start;
+            action.size = stripe_end - stripe_start;
+            action.queue_id = (request.queue_id + s) % queue_num;
+        }
+        for (gaspi_number_t s = 1; s < stripes; s++) {
+            requestAction & action = request_append(request, ACTION_FLUSH);
+            action.queue_id = (request.queue_id + s) % queue_num;
+        }
+
+        request_notify(request, comm, segment_id_remote, rank, notification_id, notification_value);
+        return;
+    }
+
+    requestAction & action = request_append(request, ACTION_WRITE);
+    action.segment_local = segment_id_local;
+    action.offset_local = offset_local;
+    action.rank = comm.ranks[rank];
+    action.segment_remote = segment_id_remote;
+    action.offset_remote = offset_remote;
+    action.size = size;
+    action.notification_id = comm.notification_offset + notification_id;
+    action.notification_value = notification_value;
+}
+
+void
+request_notify ( collRequest & request
+               , collComm const & comm
+               , gaspi_segment_id_t const segment_id_remote
+               , gaspi_rank_t const rank
+               , gaspi_notification_id_t const notification_id
+               , gaspi_notification_t const notification_value
+               )
+{
+    // a write without data only sends the notification
+    request_write(request, comm, segment_id_remote, 0, rank, segment_id_remote, 0
+                 , 0, notification_id, notification_value);
+}
+
+void
+request_reduce ( collRequest & request
+               , unsigned int const cnt
+               , const void * src
+               , void * dst
+               )
+{
+    requestAction & action = request_append(request, ACTION_REDUCE);
+    action.cnt = cnt;
+    action.src = src;
+    action.dst = dst;
+}
+
+void
+request_copy ( collRequest & request
+             , gaspi_size_t const size
+             , const void * src
+             , void * dst
+             )
+{
+    requestAction & action = request_append(request, ACTION_COPY);
+    action.size = size;
+    action.src = src;
+    action.dst = dst;
+}
+
+void
+request_flush ( collRequest & request )
+{
+    request_append(request, ACTION_FLUSH);
+}
+
+// posts a write or a notification, GASPI_TIMEOUT if the queue is full
+static gaspi_return_t
+request_post ( requestAction const & action )
+{
+    gaspi_queue_id_t const queue_id = action.queue_id;
+
+    gaspi_return_t ret;
+    if ((action.size > 0) && (action.notification_value == 0)) {
+        ret = gaspi_write(action.segment_local, action.offset_local, action.rank
+                         , action.segment_remote, action.offset_remote, action.size
+                         , queue_id, GASPI_TEST);
+    } else if (action.size > 0) {
+        ret = gaspi_write_notify(action.segment_local, action.offset_local, action.rank
+                                , action.segment_remote, action.offset_remote, action.size
+                                , action.notification_id, action.notification_value
+                                , queue_id, GASPI_TEST);
+    } else {
+        ret = gaspi_notify(action.segment_remote, action.rank
+                          , action.notification_id, action.notification_value
+                          , queue_id, GASPI_TEST);
+    }
+
+    if (ret == GASPI_QUEUE_FULL) {
+        // the write is re-submitted on the next call once the queue has drained
+        ret = gaspi_wait(queue_id, GASPI_TEST);
+        return (ret == GASPI_ERROR) ? GASPI_ERROR : GASPI_TIMEOUT;
+    }
+
+    return ret;
+}
+
+// resets the notification of a wait if it has arrived, GASPI_TIMEOUT if not
+// and GASPI_ERROR if it has arrived with another value
+static gaspi_return_t
+request_test ( requestAction const & action )
+{
+    gaspi_notification_id_t id;
+    gaspi_return_t ret = gaspi_notify_waitsome(action.segment_local, action.notification_id, 1
+                                              , &id, GASPI_TEST);
+    if (ret != GASPI_SUCCESS)
+        return ret;
+    if (id != action.notification_id)
+        return GASPI_ERROR;
+
+    gaspi_notification_t value;
+    ret = gaspi_notify_reset(action.segment_local, id, &value);
+    if (ret != GASPI_SUCCESS)
+        return ret;
+
+    return (value == action.notification_value) ? GASPI_SUCCESS : GASPI_ERROR;
+}
+
+/** Advance a nonblocking collective as far as possible without blocking
+ *
+ * The actions are executed in order until one of them would block, i.e. a
+ * notification has not arrived yet, the queue is full or not yet flushed.
+ * The request keeps the action which has blocked or failed, so the next call
+ * resumes the collective at this action.
+ *
+ * @param request The request of the collective
+ *
+ * @return GASPI_SUCCESS if the collective has completed, GASPI_TIMEOUT if it
+ * is still in progress, GASPI_ERROR in case of error
+ */
+gaspi_return_t 
+gaspi_request_test (collRequest & request)
+{
+    while (request.next < request.actions.size()) {
+        requestAction const & action = request.actions[request.next];
+        gaspi_return_t ret = GASPI_SUCCESS;
+
+        switch (action.type) {
+            case ACTION_WAIT: {
+                ret = request_test(action);
+                break;
+            }
+
+            case ACTION_WRITE: {
+                ret = request_post(action);
+                break;
+            }
+
+            case ACTION_REDUCE: {
+                request.reduce(request.op, action.cnt, action.src, action.dst);
+                break;
+            }
+
+            case ACTION_COPY: {
+                std::memcpy(action.dst, action.src, action.size);
+                break;
+            }
+
+            case ACTION_FLUSH: {
+                ret = gaspi_wait(action.queue_id, GASPI_TEST);
+                break;
+            }
+        }
+
+        if (ret != GASPI_SUCCESS)
+            return (ret == GASPI_TIMEOUT) ? GASPI_TIMEOUT : GASPI_ERROR;
+
+        request.next++;
+    }
+
+    return GASPI_SUCCESS;
+}
+
+/** Start a planned collective
+ *
+ * The actions of the plan are run from the beginning, so a request can be
+ * started again once the previous run has completed.
+ *
+ * @param request The request of the collective
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error.
+ */
+gaspi_return_t 
+gaspi_request_start (collRequest & request)
+{
+    request.next = 0;
+
+    // post the first writes
+    if (gaspi_request_test(request) == GASPI_ERROR)
+        return GASPI_ERROR;
+
+    return GASPI_SUCCESS;
+}
+
+/** Wait for a nonblocking collective
+ *
+ * @param request The request of the collective
+ * @param timeout Timeout in milliseconds (or GASPI_BLOCK/GASPI_TEST)
+ *
+ * @return GASPI_SUCCESS if the collective has completed, GASPI_TIMEOUT if it
+ * is still in progress after the timeout, GASPI_ERROR in case of error
+ */
+gaspi_return_t 
+gaspi_request_wait (collRequest & request,
+                    const gaspi_timeout_t timeout)
+{
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+
+    gaspi_return_t ret;
+    while ((ret = gaspi_request_test(request)) == GASPI_TIMEOUT) {
+        if (timeout == GASPI_BLOCK)
+            continue;
+
+        std::chrono::milliseconds const elapsed
+            = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        if ((gaspi_timeout_t) elapsed.count() >= timeout)
+            break;
+    }
+
+    return ret;
+}
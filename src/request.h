@@ -0,0 +1,75 @@
+#ifndef REQUEST_ACTIONS_H
+#define REQUEST_ACTIONS_H
+
+#include <Communicator.hxx>
+#include <Request.hxx>
+
+void
+request_init ( collRequest & request
+             , gaspi_queue_id_t const queue_id
+             , Operation const op
+             );
+
+gaspi_return_t
+request_window ( collRequest & request
+               , collComm const & comm
+               , gaspi_segment_id_t const segment_id
+               , gaspi_number_t const size
+               , gaspi_notification_id_t * const window
+               );
+
+void
+request_wait ( collRequest & request
+             , collComm const & comm
+             , gaspi_segment_id_t const segment_id
+             , gaspi_notification_id_t const notification_id
+             , gaspi_notification_t const expected
+             );
+
+void
+request_write ( collRequest & request
+              , collComm const & comm
+              , gaspi_segment_id_t const segment_id_local
+              , gaspi_offset_t const offset_local
+              , gaspi_rank_t const rank
+              , gaspi_segment_id_t const segment_id_remote
+              , gaspi_offset_t const offset_remote
+              , gaspi_size_t const size
+              , gaspi_notification_id_t const notification_id
+              , gaspi_notification_t const notification_value
+              );
+
+void
+request_notify ( collRequest & request
+               , collComm const & comm
+               , gaspi_segment_id_t const segment_id_remote
+               , gaspi_rank_t const rank
+               , gaspi_notification_id_t const notification_id
+               , gaspi_notification_t const notification_value
+               );
+
+void
+request_reduce ( collRequest & request
+               , unsigned int const cnt
+               , const void * src
+               , void * dst
+               );
+
+void
+request_copy ( collRequest & request
+             , gaspi_size_t const size
+             , const void * src
+             , void * dst
+             );
+
+void
+request_flush ( collRequest & request );
+
+// reduction of untyped data for ACTION_REDUCE
+template <typename T>
+void request_local_reduce(const Operation & op, const unsigned int size, const void *input, void *output)
+{
+    local_reduce<T>(op, size, (T const *) input, (T *) output);
+}
+
+#endif
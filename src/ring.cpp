@@ -0,0 +1,56 @@
+#include "ring.h"
+
+#include <vector>
+
+/** Position and neighbors of a process in one of several rings
+ *
+ * Ring r visits the processes with a stride which is coprime to nProc, so
+ * every ring contains all processes. The even rings run clockwise and the
+ * odd ones counter-clockwise, every pair of rings uses the next stride.
+ *
+ * @param iProc The rank of the process
+ * @param nProc The number of processes
+ * @param ring The number of the ring
+ * @param position The position of the process in the ring
+ * @param send_to The right neighbor in the ring
+ * @param recv_from The left neighbor in the ring
+ */
+void
+ring_neighbors ( gaspi_rank_t const iProc
+               , gaspi_rank_t const nProc
+               , gaspi_number_t const ring
+               , gaspi_rank_t & position
+               , gaspi_rank_t & send_to
+               , gaspi_rank_t & recv_from
+               )
+{
+    if (nProc <= 1) {
+        position = send_to = recv_from = iProc;
+        return;
+    }
+
+    // the strides up to nProc/2, larger ones give the reversed rings
+    std::vector<int> strides;
+    for (int s = 1; s <= nProc / 2; s++) {
+        int a = s, b = nProc;
+        while (b != 0) {
+            int tmp = a % b;
+            a = b;
+            b = tmp;
+        }
+        if (a == 1)
+            strides.push_back(s);
+    }
+
+    const int stride = strides[(ring / 2) % strides.size()];
+    const int step = (ring % 2 == 0) ? stride : nProc - stride;
+
+    // the process at position p is (p * step) % nProc
+    int inverse = 1;
+    while (((unsigned long) inverse * step) % nProc != 1)
+        inverse++;
+
+    position = ((unsigned long) iProc * inverse) % nProc;
+    send_to = (iProc + step) % nProc;
+    recv_from = (iProc - step + nProc) % nProc;
+}
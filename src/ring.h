@@ -0,0 +1,15 @@
+#ifndef RING_H
+#define RING_H
+
+#include <GASPI.h>
+
+void
+ring_neighbors ( gaspi_rank_t const iProc
+               , gaspi_rank_t const nProc
+               , gaspi_number_t const ring
+               , gaspi_rank_t & position
+               , gaspi_rank_t & send_to
+               , gaspi_rank_t & recv_from
+               );
+
+#endif
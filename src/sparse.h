@@ -0,0 +1,116 @@
+#ifndef SPARSE_H
+#define SPARSE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <GASPI.h>
+
+#include <DataStructsAndOps.hxx>
+
+// magnitude of an element, by which the sparse collectives select the data
+template <typename T>
+inline T sparse_magnitude(const T value)
+{
+    return std::abs(value);
+}
+
+inline unsigned int sparse_magnitude(const unsigned int value)
+{
+    return value;
+}
+
+/**
+ * Indices of the k elements with the largest magnitude in ascending order,
+ * ties are broken by the lower index. Every thread selects the k largest
+ * elements of its block with std::nth_element in linear time, and the
+ * candidates of all blocks are selected once more, so no sort of the data
+ * is needed.
+ */
+template <typename T>
+void sparse_select(T const *data, const gaspi_number_t elem_cnt, const gaspi_number_t k,
+                   std::vector<unsigned int> & indices)
+{
+    auto larger = [data](const unsigned int a, const unsigned int b) {
+        T const mag_a = sparse_magnitude(data[a]);
+        T const mag_b = sparse_magnitude(data[b]);
+        return (mag_a > mag_b) || ((mag_a == mag_b) && (a < b));
+    };
+
+    gaspi_number_t const num = MIN(k, elem_cnt);
+
+    gaspi_number_t num_blocks = 1;
+#ifdef _OPENMP
+    num_blocks = omp_get_max_threads();
+#endif
+    // a block has to hold at least k elements
+    if (num_blocks * num >= elem_cnt)
+        num_blocks = 1;
+
+    std::vector<unsigned int> candidates;
+    if (num_blocks == 1) {
+        candidates.resize(elem_cnt);
+        std::iota(candidates.begin(), candidates.end(), 0);
+    } else {
+        candidates.resize(num_blocks * num);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (gaspi_number_t b = 0; b < num_blocks; b++) {
+            gaspi_number_t const begin = b * elem_cnt / num_blocks;
+            gaspi_number_t const end = (b + 1) * elem_cnt / num_blocks;
+            std::vector<unsigned int> block(end - begin);
+            std::iota(block.begin(), block.end(), begin);
+            std::nth_element(block.begin(), block.begin() + (num - 1), block.end(), larger);
+            std::copy(block.begin(), block.begin() + num, candidates.begin() + b * num);
+        }
+    }
+
+    if (num > 0)
+        std::nth_element(candidates.begin(), candidates.begin() + (num - 1), candidates.end(), larger);
+    candidates.resize(num);
+    std::sort(candidates.begin(), candidates.end());
+
+    indices.swap(candidates);
+}
+
+/**
+ * Merge two lists of (index, value) pairs which are sorted by their index,
+ * the values of an index that is in both lists are reduced with op. The
+ * result is sorted by the index as well.
+ */
+template <typename T>
+void sparse_merge(const Operation & op,
+                  unsigned int const *idx_a, T const *val_a, const gaspi_number_t cnt_a,
+                  unsigned int const *idx_b, T const *val_b, const gaspi_number_t cnt_b,
+                  std::vector<unsigned int> & idx_out, std::vector<T> & val_out)
+{
+    idx_out.clear();
+    val_out.clear();
+    idx_out.reserve(cnt_a + cnt_b);
+    val_out.reserve(cnt_a + cnt_b);
+
+    gaspi_number_t a = 0, b = 0;
+    while ((a < cnt_a) || (b < cnt_b)) {
+        if ((b == cnt_b) || ((a < cnt_a) && (idx_a[a] < idx_b[b]))) {
+            idx_out.push_back(idx_a[a]);
+            val_out.push_back(val_a[a++]);
+        } else if ((a == cnt_a) || (idx_b[b] < idx_a[a])) {
+            idx_out.push_back(idx_b[b]);
+            val_out.push_back(val_b[b++]);
+        } else {
+            idx_out.push_back(idx_a[a]);
+            val_out.push_back(val_a[a++]);
+            local_reduce<T>(op, 1, &val_b[b++], &val_out.back());
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef SUCCESS_OR_RETURN_H
+#define SUCCESS_OR_RETURN_H
+
+#include <GASPI.h>
+
+#define SUCCESS_OR_RETURN(f)                                            \
+  do                                                                    \
+  {                                                                     \
+    const gaspi_return_t _ret = f;                                      \
+                                                                        \
+    if (_ret != GASPI_SUCCESS)                                          \
+    {                                                                   \
+      return _ret;                                                      \
+    }                                                                   \
+  } while (0)
+
+#endif
@@ -0,0 +1,60 @@
+#include "workspace.h"
+
+#include <map>
+
+#include "success_or_return.h"
+
+// current size of the workspace segments, a segment which is not in the map
+// has not been created yet
+static std::map<gaspi_segment_id_t, gaspi_size_t> workspace_size;
+
+/** Segment with the temporary data of the collectives
+ *
+ * The collectives that need space for the data of their peers, but have
+ * the same interface as the ones that do not, use the workspace segment of
+ * their communicator. The segment is created on the first call and re-created
+ * when a larger one is requested, which means that it is collective over the
+ * group of the communicator and all members have to request the same size.
+ *
+ * @param comm The communicator
+ * @param size The number of bytes which are needed
+ * @param timeout Timeout in milliseconds of the creation of the segment (or GASPI_BLOCK/GASPI_TEST)
+ * @param segment_id The id of the workspace segment
+ * @param ptr Pointer to the beginning of the segment
+ *
+ * @return GASPI_SUCCESS in case of success, GASPI_ERROR in case of
+ * error, GASPI_TIMEOUT in case of timeout, in which case the call has to
+ * be repeated with the same size
+ */
+gaspi_return_t
+workspace_segment ( collComm const & comm
+                  , gaspi_size_t const size
+                  , gaspi_timeout_t const timeout
+                  , gaspi_segment_id_t * segment_id
+                  , gaspi_pointer_t * ptr
+                  )
+{
+    *segment_id = comm.workspace;
+    gaspi_size_t & current_size = workspace_size[*segment_id];
+
+    if (size > current_size) {
+        // no process writes to the workspace segment outside of a collective,
+        // so it can be replaced without further synchronization
+        if (current_size > 0) {
+            SUCCESS_OR_RETURN( gaspi_segment_delete(*segment_id) );
+            current_size = 0;
+        }
+
+        // grow by powers of two to avoid re-creating the segment too often
+        gaspi_size_t new_size = 4096;
+        while (new_size < size)
+            new_size = new_size * 2;
+
+        SUCCESS_OR_RETURN( gaspi_segment_create(*segment_id, new_size
+                                               , comm.group, timeout
+                                               , GASPI_MEM_UNINITIALIZED) );
+        current_size = new_size;
+    }
+
+    return gaspi_segment_ptr(*segment_id, ptr);
+}
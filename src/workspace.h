@@ -0,0 +1,16 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <GASPI.h>
+
+#include <Communicator.hxx>
+
+gaspi_return_t
+workspace_segment ( collComm const & comm
+                  , gaspi_size_t const size
+                  , gaspi_timeout_t const timeout
+                  , gaspi_segment_id_t * segment_id
+                  , gaspi_pointer_t * ptr
+                  );
+
+#endif